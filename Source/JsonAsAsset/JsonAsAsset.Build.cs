@@ -59,6 +59,8 @@ public class JsonAsAsset : ModuleRules
 			"RenderCore",
 			"AnimGraphRuntime", 
 			"AnimGraph",
+			"Sockets",
+			"Networking",
 
 #if UE_5_0_OR_LATER
 			/* Only Unreal Engine 5 */
@@ -0,0 +1,100 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Importers/Constructor/DependencyPlanner.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Misc/PackageName.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/Json/MappedJsonReader.h"
+#include "Utilities/Textures/TexturePipeline.h"
+
+void FDependencyPlanner::Prefetch(const FJsonExportView& Exports) {
+	TSet<FString> References;
+	TSet<FString> Textures;
+
+	for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		CollectReferences(Export, References, Textures);
+	}
+
+	/* Textures are downloaded again even when they exist, if the settings say so */
+	const bool bDownloadExistingTextures = GetDefault<UJsonAsAssetSettings>()->AssetSettings.TextureImportSettings.bDownloadExistingTextures;
+
+	TArray<FString> Missing;
+	TArray<FString> MissingTextures;
+
+	for (const FString& ObjectPath : References) {
+		if ((bDownloadExistingTextures && Textures.Contains(ObjectPath)) || IsMissing(ObjectPath)) {
+			Missing.Add(ObjectPath);
+
+			if (Textures.Contains(ObjectPath)) {
+				MissingTextures.Add(ObjectPath);
+			}
+		}
+	}
+
+	if (Missing.Num() > 0) {
+		FAssetUtilities::PrefetchExports(Missing);
+	}
+
+	/* Their data is downloaded and decoded while the import gets to them */
+	if (MissingTextures.Num() > 0) {
+		FTexturePipeline::Enqueue(MissingTextures);
+	}
+}
+
+void FDependencyPlanner::CollectReferences(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPaths, TSet<FString>& OutTextures) {
+	if (!Value.IsValid()) return;
+
+	if (Value->Type == EJson::Object) {
+		const TSharedPtr<FJsonObject> Object = Value->AsObject();
+
+		/* { "ObjectName": "Texture2D'T_Name'", "ObjectPath": "GameName/Content/Path/T_Name.0" } */
+		FString ObjectName, ObjectPath;
+
+		if (Object->TryGetStringField(TEXT("ObjectName"), ObjectName) && Object->TryGetStringField(TEXT("ObjectPath"), ObjectPath)) {
+			FString Type, Name, PackagePath;
+
+			ObjectName.Split("'", &Type, &Name);
+			ObjectPath.Split(".", &PackagePath, nullptr);
+			Name = Name.Replace(TEXT("'"), TEXT(""));
+
+			/* Keyed the way LoadObject requests them, "/Game/Path/T_Name.T_Name" */
+			PackagePath = FAssetUtilities::NormalizePackagePath(PackagePath);
+
+			/* Same types ConstructAsset downloads, subobjects live in their outer's export */
+			const bool bIsTexture = Type == "Texture2D" || Type == "TextureRenderTarget2D" || Type == "TextureCube" || Type == "VolumeTexture";
+
+			if (!Name.Contains(TEXT(":")) && !PackagePath.IsEmpty() && (bIsTexture || IImporter::CanImport(Type, true))) {
+				OutPaths.Add(PackagePath + "." + Name);
+
+				if (bIsTexture) {
+					OutTextures.Add(PackagePath + "." + Name);
+				}
+			}
+
+			return;
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values) {
+			CollectReferences(Pair.Value, OutPaths, OutTextures);
+		}
+	}
+	/* Packed numbers can't hold references, don't expand them */
+	else if (Value->Type == EJson::Array && FJsonValuePackedNumbers::Cast(Value) == nullptr) {
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray()) {
+			CollectReferences(Element, OutPaths, OutTextures);
+		}
+	}
+}
+
+bool FDependencyPlanner::IsMissing(const FString& ObjectPath) {
+	const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+
+	if (PackageName.StartsWith(TEXT("/Script/"))) return false;
+
+	/* Created earlier in this session and not saved yet */
+	if (FindPackage(nullptr, *PackageName) != nullptr) return false;
+
+	return !FPackageName::DoesPackageExist(PackageName);
+}
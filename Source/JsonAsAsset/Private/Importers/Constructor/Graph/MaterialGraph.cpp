@@ -20,8 +20,8 @@ TSharedPtr<FJsonObject> IMaterialGraph::FindMaterialData(UObject* Parent, const
 	TSharedPtr<FJsonObject> EditorOnlyData;
 
 	/* Filter array if needed */
-	for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
-		TSharedPtr<FJsonObject> Object = TSharedPtr<FJsonObject>(Value->AsObject());
+	for (const TSharedPtr<FJsonValue>& Value : AllJsonObjects) {
+		TSharedPtr<FJsonObject> Object = Value->AsObject();
 
 		FString ExportType = Object->GetStringField(TEXT("Type"));
 		FName ExportName(Object->GetStringField(TEXT("Name")));
@@ -76,14 +76,14 @@ void IMaterialGraph::ConstructExpressions(FUObjectExportContainer& Container) {
 }
 
 void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
-	for (FUObjectExport Export : Container.Exports) {
+	for (const FUObjectExport& Export : Container.Exports) {
 		/* Get variables from the export data */
 		FName Type = Export.Type;
 		
 		UObject* Parent = Export.Parent;
 
 		/* Get Json Objects from Export */
-		TSharedPtr<FJsonObject> ExportJsonObject = Export.JsonObject;
+		const TSharedPtr<FJsonObject>& ExportJsonObject = Export.JsonObject;
 		TSharedPtr<FJsonObject> Properties = Export.GetProperties();
 
 		/* Created Expression */
@@ -112,8 +112,9 @@ void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
 			/* Add it to the subgraph function ~ UE4 ONLY */
 			UMaterialFunction* ParentSubgraphFunction = SubgraphFunctions[SubGraphExpressionName];
 
-			Export.Parent = ParentSubgraphFunction;
-			Expression = CreateEmptyExpression(Export, Container);
+			FUObjectExport SubgraphExport = Export;
+			SubgraphExport.Parent = ParentSubgraphFunction;
+			Expression = CreateEmptyExpression(SubgraphExport, Container);
 
 			Expression->Function = ParentSubgraphFunction;
 			ParentSubgraphFunction->FunctionExpressions.Add(Expression);
@@ -135,7 +136,7 @@ void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
 			
 			if (ExportJsonObject->TryGetArrayField(TEXT("Inputs"), InputsPtr)) {
 				int i = 0;
-				for (const TSharedPtr<FJsonValue> InputValue : *InputsPtr) {
+				for (const TSharedPtr<FJsonValue>& InputValue : *InputsPtr) {
 					FJsonObject* InputObject = InputValue->AsObject().Get();
 					FName InputExpressionName = GetExpressionName(InputObject);
 					
@@ -153,7 +154,7 @@ void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
 			
 			if (ExportJsonObject->TryGetArrayField(TEXT("Inputs"), InputsPtr)) {
 				int i = 0;
-				for (const TSharedPtr<FJsonValue> InputValue : *InputsPtr) {
+				for (const TSharedPtr<FJsonValue>& InputValue : *InputsPtr) {
 					FJsonObject* InputObject = InputValue->AsObject().Get();
 					FName InputExpressionName = GetExpressionName(InputObject);
 					
@@ -171,7 +172,7 @@ void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
 			
 			if (ExportJsonObject->TryGetArrayField(TEXT("Inputs"), InputsPtr)) {
 				int i = 0;
-				for (const TSharedPtr<FJsonValue> InputValue : *InputsPtr) {
+				for (const TSharedPtr<FJsonValue>& InputValue : *InputsPtr) {
 					FJsonObject* InputObject = InputValue->AsObject().Get();
 					FName InputExpressionName = GetExpressionName(InputObject);
 					
@@ -370,11 +371,10 @@ UMaterialExpression* IMaterialGraph::OnMissingNodeClass(FUObjectExport& Export,
 
 					FunctionInputExpression->InputName = FName(*ReroutePinObject->GetStringField(TEXT("Name")));
 
-					GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(ReroutePinObject,
-					{
+					GetObjectSerializer()->DeserializeObjectProperties(ReroutePinObject, FunctionInputExpression, FJsonPropertyFilter::Remove({
 						"Material",
 						"MaterialFunction",
-					}), FunctionInputExpression);
+					}));
 					
 					AddExpressionToParent(SubgraphMaterialFunction, FunctionInputExpression);
 					SetExpressionParent(SubgraphMaterialFunction, FunctionInputExpression, FunctionOutput.JsonObject);
@@ -407,11 +407,10 @@ UMaterialExpression* IMaterialGraph::OnMissingNodeClass(FUObjectExport& Export,
 
 					FunctionOutputExpression->OutputName = FName(*ReroutePinObject->GetStringField(TEXT("Name")));
 
-					GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(ReroutePinObject,
-					{
+					GetObjectSerializer()->DeserializeObjectProperties(ReroutePinObject, FunctionOutputExpression, FJsonPropertyFilter::Remove({
 						"Material",
 						"MaterialFunction",
-					}), FunctionOutputExpression);
+					}));
 
 					FGuid ID = FunctionOutputExpression->GetMaterialExpressionId();
 
@@ -2,16 +2,11 @@
 
 #include "Importers/Constructor/Graph/SoundGraph.h"
 
-#include "AssetToolsModule.h"
-#include "HttpModule.h"
-#include "Interfaces/IHttpResponse.h"
-#include "IAssetTools.h"
-#include "Misc/MessageDialog.h"
+#include "Importers/Constructor/Graph/SoundWaveImportQueue.h"
 #include "Sound/SoundCue.h"
-#include "Settings/JsonAsAssetSettings.h"
 
-void ISoundGraph::ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes) {
-	for (const TSharedPtr<FJsonValue> JsonValue : JsonArray) {
+void ISoundGraph::ConstructNodes(USoundCue* SoundCue, const FJsonExportView JsonArray, TMap<FString, USoundNode*>& OutNodes) {
+	for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray) {
 		const TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
 
 		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
@@ -40,7 +35,7 @@ USoundNode* ISoundGraph::CreateEmptyNode(FName Name, const FName Type, USoundCue
 	);
 }
 
-void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray) const {
+void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, const TMap<FString, USoundNode*>& SoundCueNodes, const FJsonExportView JsonObjectArray) const {
 	auto MainJsonObject = JsonObjectArray[0]->AsObject();
 	auto MainJsonObjectProperties = MainJsonObject->TryGetField(TEXT("Properties"))->AsObject();
 
@@ -53,7 +48,7 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 		int32 QuoteIndex = FirstNodeName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
 		FString ChildNodeName = FirstNodeName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
 
-		USoundNode** FirstNode = SoundCueNodes.Find(ChildNodeName);
+		USoundNode* const* FirstNode = SoundCueNodes.Find(ChildNodeName);
 		UEdGraphNode* RootNode = SoundCueAsset->SoundCueGraph->Nodes[0];
 
 		/* Connect Node to Root Node */
@@ -63,7 +58,7 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 	}
 
 	/* Connections done here */
-	for (TSharedPtr<FJsonValue> JsonValue : JsonObjectArray) {
+	for (const TSharedPtr<FJsonValue>& JsonValue : JsonObjectArray) {
 		TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
 
 		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
@@ -80,17 +75,17 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 
 		TSharedPtr<FJsonObject> NodeProperties = CurrentNodeObject->TryGetField(TEXT("Properties"))->AsObject();
 
-		USoundNode** CurrentNode = SoundCueNodes.Find(NodeName);
+		USoundNode* const* CurrentNode = SoundCueNodes.Find(NodeName);
 		USoundNode* Node = *CurrentNode;
 		
 		/* Filter only node with ChildNodes and handle the pins */
 		if (NodeProperties->HasField(TEXT("ChildNodes"))) {
-			TArray<TSharedPtr<FJsonValue>> CurrentNodeChildNodes = NodeProperties->TryGetField(TEXT("ChildNodes"))->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& CurrentNodeChildNodes = NodeProperties->TryGetField(TEXT("ChildNodes"))->AsArray();
 
 			/* Save an index of the current connection */
 			int32 ConnectionIndex = 0;
 
-			for (TSharedPtr<FJsonValue> CurrentNodeValue : CurrentNodeChildNodes) {
+			for (const TSharedPtr<FJsonValue>& CurrentNodeValue : CurrentNodeChildNodes) {
 				auto CurrentNodeChildNode = CurrentNodeValue->AsObject();
 
 				/* Insert a child node if it doesn't exist */
@@ -105,7 +100,7 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 					int32 QuoteIndex = CurrentChildNodeObjectName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
 					FString CurrentChildNodeName = CurrentChildNodeObjectName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
 
-					USoundNode** CurrentChildNode = SoundCueNodes.Find(CurrentChildNodeName);
+					USoundNode* const* CurrentChildNode = SoundCueNodes.Find(CurrentChildNodeName);
 					int CurrentPin = ConnectionIndex + 1;
 
 					/* Connect it */
@@ -119,10 +114,9 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 		}
 
 		/* Deserialize Node Properties */
-		GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(NodeProperties, TArray<FString>
-		{
+		GetObjectSerializer()->DeserializeObjectProperties(NodeProperties, *CurrentNode, FJsonPropertyFilter::Remove({
 			"ChildNodes"
-		}), *CurrentNode);
+		}));
 
 		/* Import Sound Wave */
 		if (Cast<USoundNodeWavePlayer>(Node) != nullptr) {
@@ -137,14 +131,8 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 				if (SoundWave != nullptr) {
 					WavePlayerNode->SetSoundWave(SoundWave);
 				} else {
-					/* Get URL from Settings */
-					const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
-
-					/* Import SoundWave */
-					FString AudioURL = FString::Format(*(Settings->LocalFetchUrl + "/api/export?raw=false&path={0}"), { AssetPtr });
-					FString AbsoluteSavePath = FString::Format(*("{0}Cache/{1}." + Settings->AssetSettings.SoundImportSettings.AudioFileExtension), { FPaths::ProjectDir(), FPaths::GetBaseFilename(AssetPtr) });
-
-					ImportSoundWave(AudioURL, AbsoluteSavePath, AssetPtr, WavePlayerNode);
+					/* Downloaded and imported with the other waves of this import */
+					FSoundWaveImportQueue::Enqueue(AssetPtr, WavePlayerNode);
 				}
 			}
 		}
@@ -161,52 +149,3 @@ void ISoundGraph::ConnectSoundNode(const USoundNode* NodeToConnect, const USound
 		NodeToConnect->GetGraphNode()->Pins[0]->MakeLinkTo(NodeToConnectTo->GetGraphNode()->Pins[Pin]);
 	}
 }
-
-void ISoundGraph::ImportSoundWave(const FString& URL, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) const {
-	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	
-	HttpRequest->OnProcessRequestComplete().BindLambda([this, SavePath, AssetPtr, Node](const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, const bool bWasSuccessful)
-	{
-		OnDownloadSoundWave(Request, Response, bWasSuccessful, SavePath, AssetPtr, Node);
-	});
-
-	HttpRequest->SetURL(URL);
-	HttpRequest->SetVerb("GET");
-	HttpRequest->ProcessRequest();
-}
-
-void ISoundGraph::OnDownloadSoundWave(FHttpRequestPtr Request, const FHttpResponsePtr& Response, bool bWasSuccessful, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) {
-	if (bWasSuccessful && Response.IsValid()) {
-		FFileHelper::SaveArrayToFile(Response->GetContent(), *SavePath);
-
-		if (!FPaths::FileExists(SavePath)) {
-			FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(FString::Format(TEXT("Failed To Find File {0} In Cache!"), { SavePath })));
-			return;
-		}
-
-		IAssetTools& AssetTools = FModuleManager::GetModuleChecked<FAssetToolsModule>("AssetTools").Get();
-		UAutomatedAssetImportData* ImportData = NewObject<UAutomatedAssetImportData>();
-		ImportData->Filenames.Add(SavePath);
-		ImportData->DestinationPath = FPaths::GetPath(AssetPtr);
-		ImportData->bReplaceExisting = true;
-		
-		auto AssetsImported = AssetTools.ImportAssetsAutomated(ImportData);
-		if (!AssetsImported.IsValidIndex(0)) {
-			USoundWave* SoundWave = Cast<USoundWave>(StaticLoadObject(USoundWave::StaticClass(), nullptr, *AssetPtr));
-			Node->SetSoundWave(SoundWave);
-
-			return;
-		}
-		
-		USoundWave* ImportedWave = Cast<USoundWave>(AssetsImported[0]);
-
-		if (!ImportedWave) {
-			FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(FString::Format(TEXT("Failed To Import Wave {0}!"), { AssetPtr })));
-			return;
-		}
-
-		Node->SetSoundWave(ImportedWave);
-	} else {
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(FString::Format(TEXT("Failed To Download Audio {0}!"), { SavePath })));
-	}
-}
\ No newline at end of file
@@ -0,0 +1,243 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Importers/Constructor/Graph/SoundWaveImportQueue.h"
+
+#include "AssetToolsModule.h"
+#include "AutomatedAssetImportData.h"
+#include "HttpModule.h"
+#include "IAssetTools.h"
+#include "JsonGlobals.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
+#include "Sound/SoundWave.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Compatibility.h"
+
+namespace {
+#if ENGINE_UE5
+	typedef TSharedRef<IHttpRequest> FWaveRequestRef;
+#else
+	typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FWaveRequestRef;
+#endif
+
+	/* A queued wave and every wave player waiting for it */
+	struct FQueuedWave {
+		FString CacheFile;
+		TArray<TWeakObjectPtr<USoundNodeWavePlayer>> Nodes;
+	};
+
+	TMap<FString, FQueuedWave> Waves;
+
+	/* Object paths waiting for a download slot, and ones with their file in the cache */
+	TArray<FString> Downloads;
+	TArray<FString> Ready;
+
+	TSet<FString> InFlight;
+
+	/* Reported together once the queue empties */
+	TArray<FString> Failures;
+
+#if ENGINE_UE5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+}
+
+void FSoundWaveImportQueue::Enqueue(const FString& ObjectPath, USoundNodeWavePlayer* Node) {
+	/* Already queued by another wave player */
+	if (FQueuedWave* Wave = Waves.Find(ObjectPath)) {
+		Wave->Nodes.Add(Node);
+		return;
+	}
+
+	FQueuedWave& Wave = Waves.Add(ObjectPath);
+	Wave.CacheFile = GetCacheFile(ObjectPath);
+	Wave.Nodes.Add(Node);
+
+	if (IsCacheFileValid(Wave.CacheFile)) {
+		Ready.Add(ObjectPath);
+	} else {
+		Downloads.Add(ObjectPath);
+	}
+
+	if (!TickerHandle.IsValid()) {
+#if ENGINE_UE5
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FSoundWaveImportQueue::Tick));
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FSoundWaveImportQueue::Tick));
+#endif
+	}
+}
+
+FString FSoundWaveImportQueue::GetCacheFile(const FString& ObjectPath) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	/* Named after the asset, the automated import names the wave after the file */
+	FString Folder = FPaths::GetPath(ObjectPath);
+	Folder.RemoveFromStart(TEXT("/"));
+
+	return FPaths::ProjectDir() / TEXT("Cache") / Folder / FPaths::GetBaseFilename(ObjectPath) + TEXT(".") + Settings->AssetSettings.SoundImportSettings.AudioFileExtension;
+}
+
+bool FSoundWaveImportQueue::IsCacheFileValid(const FString& File) {
+	const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*File));
+	if (!Reader.IsValid() || Reader->TotalSize() < 4) return false;
+
+	ANSICHAR Magic[5] = {};
+	Reader->Serialize(Magic, 4);
+
+	const FString Extension = FPaths::GetExtension(File);
+
+	if (Extension == TEXT("ogg")) return FCStringAnsi::Strcmp(Magic, "OggS") == 0;
+	if (Extension == TEXT("wav")) return FCStringAnsi::Strcmp(Magic, "RIFF") == 0;
+	if (Extension == TEXT("flac")) return FCStringAnsi::Strcmp(Magic, "fLaC") == 0;
+
+	/* Nothing to check it against, downloads are moved in place only once complete */
+	return true;
+}
+
+bool FSoundWaveImportQueue::Tick(float DeltaTime) {
+	StartDownloads();
+
+	/* Import once nothing more is arriving, or early when a batch is full */
+	if (Ready.Num() >= MaxImportBatchSize || (Ready.Num() > 0 && InFlight.Num() == 0 && Downloads.Num() == 0)) {
+		ImportReady();
+	}
+
+	if (Waves.Num() == 0) {
+		Finish();
+		return false;
+	}
+
+	return true;
+}
+
+void FSoundWaveImportQueue::StartDownloads() {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	while (InFlight.Num() < MaxConcurrentDownloads && Downloads.Num() > 0) {
+		const FString ObjectPath = Downloads[0];
+		Downloads.RemoveAt(0);
+
+		const FWaveRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
+
+		HttpRequest->SetURL(Settings->LocalFetchUrl + "/api/export?raw=false&path=" + ObjectPath);
+		HttpRequest->SetVerb(TEXT("GET"));
+
+		HttpRequest->OnProcessRequestComplete().BindLambda([ObjectPath](FHttpRequestPtr Request, const FHttpResponsePtr Response, const bool bWasSuccessful) {
+			/* Some HTTP modules also complete requests that failed to start */
+			if (InFlight.Remove(ObjectPath) == 0) return;
+
+			const FQueuedWave* Wave = Waves.Find(ObjectPath);
+			if (Wave == nullptr) return;
+
+			if (!bWasSuccessful || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode())) {
+				UE_LOG(LogJson, Error, TEXT("Failed to download audio \"%s\""), *ObjectPath);
+
+				Failures.Add(ObjectPath);
+				Waves.Remove(ObjectPath);
+
+				return;
+			}
+
+			/* Written next to it and moved in place, the cache never holds a partial file */
+			const FString TempFile = Wave->CacheFile + TEXT(".tmp");
+
+			if (!FFileHelper::SaveArrayToFile(Response->GetContent(), *TempFile) || !IFileManager::Get().Move(*Wave->CacheFile, *TempFile, true, true)) {
+				UE_LOG(LogJson, Error, TEXT("Failed to write audio to \"%s\""), *Wave->CacheFile);
+				IFileManager::Get().Delete(*TempFile);
+
+				Failures.Add(ObjectPath);
+				Waves.Remove(ObjectPath);
+
+				return;
+			}
+
+			Ready.Add(ObjectPath);
+		});
+
+		InFlight.Add(ObjectPath);
+
+		if (!HttpRequest->ProcessRequest() && InFlight.Remove(ObjectPath) > 0) {
+			Failures.Add(ObjectPath);
+			Waves.Remove(ObjectPath);
+		}
+	}
+}
+
+void FSoundWaveImportQueue::ImportReady() {
+	/* The automated import takes one destination, so batches are per folder */
+	TMap<FString, TArray<FString>> Folders;
+
+	for (const FString& ObjectPath : Ready) {
+		Folders.FindOrAdd(FPaths::GetPath(ObjectPath)).Add(ObjectPath);
+	}
+
+	Ready.Empty();
+
+	IAssetTools& AssetTools = FModuleManager::GetModuleChecked<FAssetToolsModule>("AssetTools").Get();
+
+	for (const TPair<FString, TArray<FString>>& Folder : Folders) {
+		for (int32 Start = 0; Start < Folder.Value.Num(); Start += MaxImportBatchSize) {
+			const TArray<FString> Batch(Folder.Value.GetData() + Start, FMath::Min(MaxImportBatchSize, Folder.Value.Num() - Start));
+
+			UAutomatedAssetImportData* ImportData = NewObject<UAutomatedAssetImportData>();
+			ImportData->DestinationPath = Folder.Key;
+			ImportData->bReplaceExisting = true;
+
+			for (const FString& ObjectPath : Batch) {
+				ImportData->Filenames.Add(Waves[ObjectPath].CacheFile);
+			}
+
+			AssetTools.ImportAssetsAutomated(ImportData);
+
+			/* Looked up by path, the returned array skips waves that were replaced in place */
+			for (const FString& ObjectPath : Batch) {
+				USoundWave* SoundWave = Cast<USoundWave>(StaticLoadObject(USoundWave::StaticClass(), nullptr, *ObjectPath));
+
+				if (SoundWave == nullptr) {
+					UE_LOG(LogJson, Error, TEXT("Failed to import wave \"%s\""), *ObjectPath);
+					Failures.Add(ObjectPath);
+				} else {
+					for (const TWeakObjectPtr<USoundNodeWavePlayer>& Node : Waves[ObjectPath].Nodes) {
+						if (Node.IsValid()) {
+							Node->SetSoundWave(SoundWave);
+						}
+					}
+				}
+
+				Waves.Remove(ObjectPath);
+			}
+		}
+	}
+}
+
+void FSoundWaveImportQueue::Finish() {
+	TickerHandle.Reset();
+
+	if (Failures.Num() == 0) return;
+
+	/* One dialog for the whole queue, a bank of cues can reference hundreds of waves */
+	constexpr int32 MaxListed = 20;
+
+	FString Message = FString::Printf(TEXT("Failed To Import %d Sound Waves!\n"), Failures.Num());
+
+	for (int32 Index = 0; Index < FMath::Min(MaxListed, Failures.Num()); Index++) {
+		Message += TEXT("\n") + Failures[Index];
+	}
+
+	if (Failures.Num() > MaxListed) {
+		Message += FString::Printf(TEXT("\n... and %d more, see the log"), Failures.Num() - MaxListed);
+	}
+
+	Failures.Empty();
+
+	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
+}
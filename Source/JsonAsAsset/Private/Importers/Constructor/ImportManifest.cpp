@@ -0,0 +1,324 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Importers/Constructor/ImportManifest.h"
+
+#include "JsonObjectConverter.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/Compatibility.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+/* Bump when the entry format or what gets recorded changes */
+static constexpr int32 ImportManifestVersion = 2;
+
+/* Created on the first import */
+static TUniquePtr<FImportManifest> ManifestInstance;
+
+FImportManifest& FImportManifest::Get() {
+	if (!ManifestInstance.IsValid()) {
+		ManifestInstance.Reset(new FImportManifest(GetDefaultManifestFile()));
+	}
+
+	return *ManifestInstance;
+}
+
+FImportManifest::FImportManifest(const FString& InManifestFile)
+	: ManifestFile(InManifestFile) {
+	Load();
+}
+
+FImportManifest::~FImportManifest() {
+	/* The scheduled save points at this manifest */
+	if (SaveTickerHandle.IsValid()) {
+#if ENGINE_UE5
+		FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+#endif
+	}
+
+	if (bDirty) {
+		Save();
+	}
+}
+
+bool FImportManifest::IsUpToDate(const FString& InFile) {
+	/* Settings changed in this session, nothing imported before is valid */
+	const FString CurrentSettingsHash = GetSettingsHash();
+
+	if (CurrentSettingsHash != SettingsHash) {
+		SettingsHash = CurrentSettingsHash;
+		Entries.Empty();
+		PackageSources.Empty();
+
+		MarkDirty();
+	}
+
+	const FString File = NormalizeFile(InFile);
+
+	const FEntry* Entry = Entries.Find(File);
+	if (Entry == nullptr) return false;
+
+	if (GetFileHash(File) != Entry->Hash) return false;
+
+	/* Deleted or moved in the editor */
+	for (const FString& Package : Entry->Packages) {
+		if (!FPackageName::DoesPackageExist(Package)) {
+			return false;
+		}
+	}
+
+	/* A referenced asset changed since, re-import so this one picks it up */
+	for (const TPair<FString, FString>& Dependency : Entry->Dependencies) {
+		const FString* SourceFile = PackageSources.Find(Dependency.Key);
+
+		/* Not imported from a file, nothing to compare against */
+		if (SourceFile == nullptr || *SourceFile == File) continue;
+
+		if (GetFileHash(*SourceFile) != Dependency.Value) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FImportManifest::Record(const FString& InFile, const FJsonExportView& Exports, const TArray<FString>& Packages) {
+	const FString File = NormalizeFile(InFile);
+
+	if (const FEntry* Existing = Entries.Find(File)) {
+		for (const FString& Package : Existing->Packages) {
+			PackageSources.Remove(Package);
+		}
+
+		Entries.Remove(File);
+	}
+
+	if (Packages.Num() > 0) {
+		FEntry Entry;
+		Entry.Hash = GetFileHash(File);
+		Entry.Packages = Packages;
+
+		if (const FCachedHash* Cached = HashCache.Find(File)) {
+			Entry.Size = Cached->Size;
+			Entry.Timestamp = Cached->Timestamp;
+		}
+
+		for (const FString& Package : Packages) {
+			PackageSources.Add(Package, File);
+		}
+
+		TSet<FString> References;
+
+		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+			CollectReferences(Export, References);
+		}
+
+		for (const FString& Package : References) {
+			if (Packages.Contains(Package)) continue;
+
+			const FString* SourceFile = PackageSources.Find(Package);
+			Entry.Dependencies.Add(Package, SourceFile != nullptr ? GetFileHash(*SourceFile) : FString());
+		}
+
+		Entries.Add(File, MoveTemp(Entry));
+	}
+
+	MarkDirty();
+}
+
+void FImportManifest::Flush() {
+	/* Saved by the destructor, while the core ticker still exists */
+	ManifestInstance.Reset();
+}
+
+void FImportManifest::MarkDirty() {
+	bDirty = true;
+
+	/* Batches call Record once per file, write once at the end of the frame instead */
+	if (SaveTickerHandle.IsValid() || !IsInGameThread()) return;
+
+#if ENGINE_UE5
+	SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime) {
+#else
+	SaveTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime) {
+#endif
+		SaveTickerHandle.Reset();
+
+		if (bDirty) {
+			Save();
+		}
+
+		return false;
+	}));
+}
+
+FString FImportManifest::GetFileHash(const FString& File) {
+	IFileManager& FileManager = IFileManager::Get();
+
+	const int64 Size = FileManager.FileSize(*File);
+	if (Size < 0) return FString();
+
+	const FDateTime Timestamp = FileManager.GetTimeStamp(*File);
+
+	if (const FCachedHash* Cached = HashCache.Find(File)) {
+		if (Cached->Size == Size && Cached->Timestamp == Timestamp) {
+			return Cached->Hash;
+		}
+	}
+
+	FCachedHash& Cached = HashCache.FindOrAdd(File);
+	Cached.Size = Size;
+	Cached.Timestamp = Timestamp;
+	Cached.Hash = LexToString(FMD5Hash::HashFile(*File));
+
+	return Cached.Hash;
+}
+
+FString FImportManifest::GetSettingsHash() {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	FString SettingsString;
+	FJsonObjectConverter::UStructToJsonObjectString(Settings->AssetSettings, SettingsString);
+
+	return FMD5::HashAnsiString(*FString::Printf(TEXT("%d%s"), ImportManifestVersion, *SettingsString));
+}
+
+FString FImportManifest::NormalizeFile(const FString& File) {
+	FString Normalized = FPaths::ConvertRelativePathToFull(File);
+	FPaths::NormalizeFilename(Normalized);
+
+	return Normalized;
+}
+
+FString FImportManifest::GetDefaultManifestFile() {
+	return FPaths::ProjectSavedDir() / TEXT("JsonAsAsset") / TEXT("ImportManifest.json");
+}
+
+void FImportManifest::CollectReferences(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPackages) {
+	if (!Value.IsValid()) return;
+
+	if (Value->Type == EJson::Object) {
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Value->AsObject()->Values) {
+			FString ObjectPath;
+
+			if (Pair.Key == TEXT("ObjectPath") && Pair.Value.IsValid() && Pair.Value->TryGetString(ObjectPath)) {
+				/* Same package names the importer creates, so they match PackageSources */
+				OutPackages.Add(FAssetUtilities::NormalizePackagePath(FPackageName::ObjectPathToPackageName(ObjectPath)));
+			} else {
+				CollectReferences(Pair.Value, OutPackages);
+			}
+		}
+	}
+	/* Packed numbers can't hold references, don't expand them */
+	else if (Value->Type == EJson::Array && FJsonValuePackedNumbers::Cast(Value) == nullptr) {
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray()) {
+			CollectReferences(Element, OutPackages);
+		}
+	}
+}
+
+void FImportManifest::Load() {
+	SettingsHash = GetSettingsHash();
+
+	if (!FPaths::FileExists(ManifestFile)) return;
+
+	const TSharedPtr<FJsonValue> Root = FMappedJsonReader::ReadFile(ManifestFile);
+	if (!Root.IsValid() || Root->Type != EJson::Object) return;
+
+	const TSharedPtr<FJsonObject> RootObject = Root->AsObject();
+
+	/* Imported with different settings, everything has to be redone */
+	if (RootObject->GetStringField(TEXT("Settings")) != SettingsHash) {
+		UE_LOG(LogJson, Log, TEXT("Import settings changed, ignoring the import manifest"));
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* Files;
+	if (!RootObject->TryGetObjectField(TEXT("Files"), Files)) return;
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Files)->Values) {
+		const TSharedPtr<FJsonObject> EntryObject = Pair.Value->AsObject();
+		if (!EntryObject.IsValid()) continue;
+
+		FEntry Entry;
+		Entry.Hash = EntryObject->GetStringField(TEXT("Hash"));
+		EntryObject->TryGetStringArrayField(TEXT("Packages"), Entry.Packages);
+
+		/* int64 ticks don't fit in a double, kept as strings */
+		Entry.Size = FCString::Atoi64(*EntryObject->GetStringField(TEXT("Size")));
+		Entry.Timestamp = FDateTime(FCString::Atoi64(*EntryObject->GetStringField(TEXT("Timestamp"))));
+
+		const TSharedPtr<FJsonObject>* Dependencies;
+		if (EntryObject->TryGetObjectField(TEXT("Dependencies"), Dependencies)) {
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Dependency : (*Dependencies)->Values) {
+				Entry.Dependencies.Add(Dependency.Key, Dependency.Value->AsString());
+			}
+		}
+
+		for (const FString& Package : Entry.Packages) {
+			PackageSources.Add(Package, Pair.Key);
+		}
+
+		/* Seed the hash cache, unchanged files aren't read again */
+		FCachedHash& Cached = HashCache.Add(Pair.Key);
+		Cached.Size = Entry.Size;
+		Cached.Timestamp = Entry.Timestamp;
+		Cached.Hash = Entry.Hash;
+
+		Entries.Add(Pair.Key, MoveTemp(Entry));
+	}
+
+	UE_LOG(LogJson, Log, TEXT("Loaded import manifest with %d files"), Entries.Num());
+}
+
+void FImportManifest::Save() {
+	const TSharedRef<FJsonObject> Files = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, FEntry>& Pair : Entries) {
+		const FEntry& Entry = Pair.Value;
+		const TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+
+		EntryObject->SetStringField(TEXT("Hash"), Entry.Hash);
+		EntryObject->SetStringField(TEXT("Size"), LexToString(Entry.Size));
+		EntryObject->SetStringField(TEXT("Timestamp"), LexToString(Entry.Timestamp.GetTicks()));
+
+		TArray<TSharedPtr<FJsonValue>> Packages;
+		for (const FString& Package : Entry.Packages) {
+			Packages.Add(MakeShared<FJsonValueString>(Package));
+		}
+
+		EntryObject->SetArrayField(TEXT("Packages"), Packages);
+
+		const TSharedRef<FJsonObject> Dependencies = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Dependency : Entry.Dependencies) {
+			Dependencies->SetStringField(Dependency.Key, Dependency.Value);
+		}
+
+		EntryObject->SetObjectField(TEXT("Dependencies"), Dependencies);
+
+		Files->SetObjectField(Pair.Key, EntryObject);
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Settings"), SettingsHash);
+	Root->SetObjectField(TEXT("Files"), Files);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	if (FFileHelper::SaveStringToFile(Output, *ManifestFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)) {
+		bDirty = false;
+	} else {
+		UE_LOG(LogJson, Warning, TEXT("Failed to write the import manifest to \"%s\""), *ManifestFile);
+	}
+}
@@ -10,8 +10,12 @@
 
 /* Utilities */
 #include "Utilities/AssetUtilities.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Json/JsonImportScope.h"
+#include "Utilities/Textures/TexturePipeline.h"
 
 #include "Misc/MessageDialog.h"
+#include "Misc/ScopeExit.h"
 #include "UObject/SavePackage.h"
 
 /* Slate Icons */
@@ -21,6 +25,8 @@
 
 /* Templated Class */
 #include "Importers/Constructor/TemplatedImporter.h"
+#include "Importers/Constructor/ImportManifest.h"
+#include "Importers/Constructor/DependencyPlanner.h"
 
 /* ~~~~~~~~~~~~~ Templated Engine Classes ~~~~~~~~~~~~~ */
 #include "Materials/MaterialParameterCollection.h"
@@ -35,7 +41,7 @@
 /* Importer Constructor */
 IImporter::IImporter(const FString& FileName, const FString& FilePath, 
 		  const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, 
-		  UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects,
+		  UPackage* OutermostPkg, const FJsonExportView& AllJsonObjects,
 		  UClass* AssetClass)
 	: USerializerContainer(Package, OutermostPkg), AllJsonObjects(AllJsonObjects), JsonObject(JsonObject),
 	  FileName(FileName), FilePath(FilePath), AssetClass(AssetClass),
@@ -138,7 +144,25 @@ TMap<FString, TArray<FString>> ImporterTemplatedTypes = {
 	}
 };
 
-bool IImporter::ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FString File, const bool bHideNotifications) {
+bool IImporter::ReadExportsAndImport(const FJsonExportView Exports, FString File, const bool bHideNotifications, TArray<FString>* OutPackages) {
+	/* Prefetched exports and textures are kept until the outermost import is done */
+	static int32 ImportDepth = 0;
+	ImportDepth++;
+
+	ON_SCOPE_EXIT {
+		if (--ImportDepth == 0) {
+			FAssetUtilities::ClearPrefetchedExports();
+			FTexturePipeline::Reset();
+		}
+	};
+
+	/* References that will be downloaded, fetched in a few batches instead of one request each */
+	if (GetDefault<UJsonAsAssetSettings>()->bEnableLocalFetch) {
+		FDependencyPlanner::Prefetch(Exports);
+	}
+
+	bool bAllSuccessful = true;
+
 	for (const TSharedPtr<FJsonValue>& ExportPtr : Exports) {
 		TSharedPtr<FJsonObject> DataObject = ExportPtr->AsObject();
 
@@ -156,29 +180,33 @@ bool IImporter::ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FSt
 		/* Convert from relative path to full path */
 		if (FPaths::IsRelative(File)) File = FPaths::ConvertRelativePathToFull(File);
 
+		FImportProfiler::FAssetScope ProfilerAsset(Name, Type, File);
+
 		UPackage* LocalOutermostPkg;
 		UPackage* LocalPackage = FAssetUtilities::CreateAssetPackage(Name, File, LocalOutermostPkg);
 
 		/* Importer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		IImporter* Importer = nullptr;
-		
-		/* Try to find the importer using a factory delegate */
-		if (const FImporterFactoryDelegate* Factory = FindFactoryForAssetType(Type)) {
-			Importer = (*Factory)(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
-		}
+		IImporter* Importer = nullptr; {
+			JSONASASSET_PHASE_SCOPE(FindImporter);
 
-		/* If it inherits DataAsset, use the data asset importer */
-		if (Importer == nullptr && InheritsDataAsset) {
-			Importer = new IDataAssetImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
-		}
+			/* Try to find the importer using a factory delegate */
+			if (const FImporterFactoryDelegate* Factory = FindFactoryForAssetType(Type)) {
+				Importer = (*Factory)(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
+			}
 
-		/*
-		 * By default, (with no existing importer) use the templated importer with the asset class.
-		 */
-		if (Importer == nullptr) {
-			Importer = new ITemplatedImporter<UObject>(
-				Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class
-			);
+			/* If it inherits DataAsset, use the data asset importer */
+			if (Importer == nullptr && InheritsDataAsset) {
+				Importer = new IDataAssetImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
+			}
+
+			/*
+			 * By default, (with no existing importer) use the templated importer with the asset class.
+			 */
+			if (Importer == nullptr) {
+				Importer = new ITemplatedImporter<UObject>(
+					Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class
+				);
+			}
 		}
 
 		/* Import the asset ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -190,6 +218,12 @@ bool IImporter::ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FSt
 			}
 		}
 
+		if (Successful && OutPackages != nullptr) {
+			OutPackages->Add(LocalPackage->GetName());
+		}
+
+		bAllSuccessful &= Successful;
+
 		if (bHideNotifications) {
 			return Successful;
 		}
@@ -228,7 +262,7 @@ bool IImporter::ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FSt
 		}
 	}
 
-	return true;
+	return bAllSuccessful;
 }
 
 TArray<TSharedPtr<FJsonValue>> IImporter::GetObjectsWithTypeStartingWith(const FString& StartsWithStr) {
@@ -277,6 +311,8 @@ template TObjectPtr<UObject> IImporter::DownloadWrapper<UObject>(TObjectPtr<UObj
 
 template <typename T>
 TObjectPtr<T> IImporter::DownloadWrapper(TObjectPtr<T> InObject, FString Type, const FString Name, const FString Path) {
+	JSONASASSET_PHASE_SCOPE(ResolveReference);
+
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
 	FMessageLog MessageLogger = FMessageLog(FName("JsonAsAsset"));
@@ -341,19 +377,15 @@ template void IImporter::LoadObject<USoundNode>(const TSharedPtr<FJsonObject>*,
 
 template <typename T>
 void IImporter::LoadObject(const TSharedPtr<FJsonObject>* PackageIndex, TObjectPtr<T>& Object) {
+	JSONASASSET_PHASE_SCOPE(ResolveReference);
+
 	FString ObjectType, ObjectName, ObjectPath, Outer;
 	PackageIndex->Get()->GetStringField(TEXT("ObjectName")).Split("'", &ObjectType, &ObjectName);
 
 	ObjectPath = PackageIndex->Get()->GetStringField(TEXT("ObjectPath"));
 	ObjectPath.Split(".", &ObjectPath, nullptr);
+	ObjectPath = FAssetUtilities::NormalizePackagePath(ObjectPath);
 
-	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
-
-	if (!Settings->AssetSettings.GameName.IsEmpty()) {
-		ObjectPath = ObjectPath.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
-	}
-
-	ObjectPath = ObjectPath.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
 	ObjectName = ObjectName.Replace(TEXT("'"), TEXT(""));
 
 	if (ObjectName.Contains(".")) {
@@ -397,6 +429,8 @@ template TArray<TObjectPtr<UCurveLinearColor>> IImporter::LoadObject<UCurveLinea
 
 template <typename T>
 TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>& PackageArray, TArray<TObjectPtr<T>> Array) {
+	JSONASASSET_PHASE_SCOPE(ResolveReference);
+
 	for (const TSharedPtr<FJsonValue>& ArrayElement : PackageArray) {
 		const TSharedPtr<FJsonObject> ObjectPtr = ArrayElement->AsObject();
 
@@ -404,6 +438,7 @@ TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>
 		
 		ObjectPtr->GetStringField(TEXT("ObjectName")).Split("'", &ObjectType, &ObjectName);
 		ObjectPtr->GetStringField(TEXT("ObjectPath")).Split(".", &ObjectPath, nullptr);
+		ObjectPath = FAssetUtilities::NormalizePackagePath(ObjectPath);
 		ObjectName = ObjectName.Replace(TEXT("'"), TEXT(""));
 
 		TObjectPtr<T> LoadedObject = Cast<T>(StaticLoadObject(T::StaticClass(), nullptr, *(ObjectPath + "." + ObjectName)));
@@ -414,30 +449,41 @@ TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>
 }
 
 void IImporter::ImportReference(const FString& File) {
-	/* ~~~~  Parse JSON into UE JSON Reader ~~~~ */
-	FString ContentBefore;
-	FFileHelper::LoadFileToString(ContentBefore, *File);
+	FImportProfiler::FBatchScope ProfilerBatch;
 
-	FString Content = FString(TEXT("{\"data\": "));
-	Content.Append(ContentBefore);
-	Content.Append(FString("}"));
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+	FImportManifest& Manifest = FImportManifest::Get();
+
+	/* Checked before reading, an unchanged file only costs a stat */
+	if (Settings->bSkipUnchangedImports && Manifest.IsUpToDate(File)) {
+		UE_LOG(LogJson, Log, TEXT("Skipped \"%s\", unchanged since the last import"), *FPaths::GetCleanFilename(File));
+		FMessageLog(FName("JsonAsAsset")).Message(EMessageSeverity::Info, FText::FromString("Skipped Unchanged: " + FPaths::GetBaseFilename(File)));
+
+		return;
+	}
+
+	/* ~~~~  Parse the UTF-8 file in place ~~~~ */
+	FJsonImportScope Scope(File);
 
-	TSharedPtr<FJsonObject> JsonParsed;
-	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
-	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	bool bRead; {
+		JSONASASSET_PHASE_SCOPE(Parse);
+		bRead = Scope.ReadFile();
+	}
 
-	if (FJsonSerializer::Deserialize(JsonReader, JsonParsed)) {
-		const TArray<TSharedPtr<FJsonValue>> DataObjects = JsonParsed->GetArrayField(TEXT("data"));
+	if (bRead) {
+		TArray<FString> Packages;
+		const bool bImported = ReadExportsAndImport(Scope.GetExports(), File, false, &Packages);
 
-		ReadExportsAndImport(DataObjects, File);
+		/* A partial import is dropped from the manifest, so the failed exports are retried next time */
+		Manifest.Record(File, Scope.GetExports(), bImported ? Packages : TArray<FString>());
 	}
 }
 
 TMap<FName, FExportData> IImporter::CreateExports() {
 	TMap<FName, FExportData> OutExports;
 
-	for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
-		TSharedPtr<FJsonObject> Object = TSharedPtr<FJsonObject>(Value->AsObject());
+	for (const TSharedPtr<FJsonValue>& Value : AllJsonObjects) {
+		TSharedPtr<FJsonObject> Object = Value->AsObject();
 
 		FString ExType = Object->GetStringField(TEXT("Type"));
 		FString Name = Object->GetStringField(TEXT("Name"));
@@ -454,6 +500,8 @@ TMap<FName, FExportData> IImporter::CreateExports() {
 }
 
 void IImporter::SavePackage() const {
+	JSONASASSET_PHASE_SCOPE(SavePackage);
+
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
 	/* Ensure the package is valid before proceeding */
@@ -504,12 +552,12 @@ FName IImporter::GetExportNameOfSubobject(const FString& PackageIndex) {
 TArray<TSharedPtr<FJsonValue>> IImporter::FilterExportsByOuter(const FString& Outer) {
 	TArray<TSharedPtr<FJsonValue>> ReturnValue = TArray<TSharedPtr<FJsonValue>>();
 
-	for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
-		const TSharedPtr<FJsonObject> ValueObject = TSharedPtr<FJsonObject>(Value->AsObject());
+	for (const TSharedPtr<FJsonValue>& Value : AllJsonObjects) {
+		const TSharedPtr<FJsonObject> ValueObject = Value->AsObject();
 
 		FString ExportOuter;
 		if (ValueObject->TryGetStringField(TEXT("Outer"), ExportOuter) && ExportOuter == Outer) 
-			ReturnValue.Add(TSharedPtr<FJsonValue>(Value));
+			ReturnValue.Add(Value);
 	}
 
 	return ReturnValue;
@@ -52,7 +52,7 @@ bool IAnimationBaseImporter::Import() {
 	ObjectSerializer->DeserializeExports(AllJsonObjects);
 
 	/* Deserialize properties */
-	GetObjectSerializer()->DeserializeObjectProperties(KeepPropertiesShared(AssetData, {
+	GetObjectSerializer()->DeserializeObjectProperties(AssetData, AnimSequenceBase, FJsonPropertyFilter::Keep({
 		"RetargetSource",
 		
 		"AdditiveAnimType",
@@ -67,7 +67,7 @@ bool IAnimationBaseImporter::Import() {
 		"SlotAnimTracks",
 		"CompositeSections",
 		"Skeleton"
-	}), AnimSequenceBase);
+	}));
 
 	USkeleton* Skeleton = AnimSequenceBase->GetSkeleton();
 	ensure(Skeleton);
@@ -7,10 +7,9 @@ bool IPoseAssetImporter::Import() {
 	UPoseAsset* PoseAsset = NewObject<UPoseAsset>(OutermostPkg, UPoseAsset::StaticClass(), *FileName, RF_Standalone | RF_Public);
 
 	/* Set Skeleton, so we can use it in the uncooking process */
-	GetObjectSerializer()->DeserializeObjectProperties(KeepPropertiesShared(AssetData,
-	{
+	GetObjectSerializer()->DeserializeObjectProperties(AssetData, PoseAsset, FJsonPropertyFilter::Keep({
 		"Skeleton"
-	}), PoseAsset);
+	}));
 
 	/* Reverse LocalSpacePose (cooked data) back to source data */
 	ReverseCookLocalSpacePose(PoseAsset->GetSkeleton());
@@ -36,17 +35,24 @@ void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton) const {
 	}
 	
 	const TSharedPtr<FJsonObject> PoseContainer = AssetData->GetObjectField(TEXT("PoseContainer"));
-	const TArray<TSharedPtr<FJsonValue>> TracksJson = PoseContainer->GetArrayField(TEXT("Tracks"));
-	const TArray<TSharedPtr<FJsonValue>> PosesJson = PoseContainer->GetArrayField(TEXT("Poses"));
+	const TArray<TSharedPtr<FJsonValue>>& TracksJson = PoseContainer->GetArrayField(TEXT("Tracks"));
+	const TArray<TSharedPtr<FJsonValue>>& PosesJson = PoseContainer->GetArrayField(TEXT("Poses"));
 
 	const int32 NumTracks = TracksJson.Num();
 
-	for (TSharedPtr<FJsonValue> PoseValue : PosesJson) {
+	for (const TSharedPtr<FJsonValue>& PoseValue : PosesJson) {
 		TSharedPtr<FJsonObject> Pose = PoseValue->AsObject();
 		
 		if (!Pose.IsValid()) {
 			continue;
 		}
+
+		/* Curve weights are cooked as they are, only the editor copy is stripped. Kept packed, the property serializer writes them without expanding. */
+		TArray<double> CurveData;
+
+		if (TryGetNumberArrayField(Pose, TEXT("CurveData"), CurveData)) {
+			Pose->SetField(TEXT("SourceCurveData"), MakeShared<FJsonValuePackedNumbers>(MoveTemp(CurveData)));
+		}
 		
 		/* Read the optimized LocalSpacePose array */
 		TArray<TSharedPtr<FJsonValue>> LocalSpacePoseJson; {
@@ -85,7 +91,7 @@ void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton) const {
 					const int32 BoneIndex = ReferenceSkeleton.FindBoneIndex(FName(*TracksJson[i]->AsString()));
 				
 					if (BoneIndex != INDEX_NONE) {
-						const TArray<FTransform> ReferencePose = Skeleton->GetRefLocalPoses();
+						const TArray<FTransform>& ReferencePose = Skeleton->GetRefLocalPoses();
 					
 						if (ReferencePose.IsValidIndex(BoneIndex)) {
 							DefaultTransform = ReferencePose[BoneIndex];
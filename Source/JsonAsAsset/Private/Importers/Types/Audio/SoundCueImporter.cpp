@@ -18,10 +18,9 @@ bool ISoundCueImporter::Import() {
 	}
 	/* End of importing nodes ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData, TArray<FString>
-	{
+	GetObjectSerializer()->DeserializeObjectProperties(AssetData, SoundCue, FJsonPropertyFilter::Remove({
 		"FirstNode"
-	}), SoundCue);
+	}));
 	
 	SoundCue->PostEditChange();
 	SoundCue->CompileSoundNodesFromGraphNodes();
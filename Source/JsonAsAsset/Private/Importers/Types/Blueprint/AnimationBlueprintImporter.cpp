@@ -37,10 +37,10 @@ bool IAnimationBlueprintImporter::Import() {
 	if (!RootAnimNodeProperties.IsValid()) return false;
 
 	UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(AnimBlueprint->GeneratedClass);
-	GObjectSerializer->Exports = AllJsonObjects;
-	GObjectSerializer->DeserializeObjectProperties(RemovePropertiesShared(RootAnimNodeProperties, {
+	GObjectSerializer->SetupExports(AllJsonObjects);
+	GObjectSerializer->DeserializeObjectProperties(RootAnimNodeProperties, GeneratedClass->GetDefaultObject(), FJsonPropertyFilter::Remove({
 		"RootComponent"
-	}), GeneratedClass->GetDefaultObject());
+	}));
 
 	/* Newer Unreal Engine versions use CopyRecords and SerializedSparseClassData */
 	if (RootAnimNodeDefaults->HasField(TEXT("SerializedSparseClassData"))) {
@@ -152,7 +152,7 @@ inline void HarvestAndTagConnectedStateMachineNodes(const FString& StartKey, con
 	}
 }
 
-inline void HandlePropertyBinding(FUObjectExport NodeExport, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects, UAnimGraphNode_Base* Node, IImporter* Importer, UAnimBlueprint* AnimBlueprint) {
+inline void HandlePropertyBinding(FUObjectExport NodeExport, const FJsonExportView AllJsonObjects, UAnimGraphNode_Base* Node, IImporter* Importer, UAnimBlueprint* AnimBlueprint) {
 	const TSharedPtr<FJsonObject> NodeProperties = NodeExport.JsonObject;
 	
 	/* Let the user know that this node has nodes plugged into it */
@@ -10,6 +10,7 @@
 #endif
 
 #include "Factories/MaterialFactoryNew.h"
+#include "Utilities/ImportProfiler.h"
 #include "Settings/JsonAsAssetSettings.h"
 
 bool IMaterialImporter::Import() {
@@ -122,16 +123,21 @@ bool IMaterialImporter::Import() {
 	/* Deserialize any properties */
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, Material);
 
-	Material->UpdateCachedExpressionData();
-	
-	FMaterialUpdateContext MaterialUpdateContext;
-	MaterialUpdateContext.AddMaterial(Material);
-	
-	Material->ForceRecompileForRendering();
+	/* Update context recompiles the material's dependents when it goes out of scope */
+	{
+		JSONASASSET_PHASE_SCOPE(MaterialCompile);
+
+		Material->UpdateCachedExpressionData();
+		
+		FMaterialUpdateContext MaterialUpdateContext;
+		MaterialUpdateContext.AddMaterial(Material);
+		
+		Material->ForceRecompileForRendering();
 
-	Material->PostEditChange();
-	Material->MarkPackageDirty();
-	Material->PreEditChange(nullptr);
+		Material->PostEditChange();
+		Material->MarkPackageDirty();
+		Material->PreEditChange(nullptr);
+	}
 
 	SavePackage();
 
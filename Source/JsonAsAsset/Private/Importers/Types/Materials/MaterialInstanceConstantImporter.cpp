@@ -9,10 +9,9 @@
 bool IMaterialInstanceConstantImporter::Import() {
 	UMaterialInstanceConstant* MaterialInstanceConstant = NewObject<UMaterialInstanceConstant>(Package, UMaterialInstanceConstant::StaticClass(), *FileName, RF_Public | RF_Standalone);
 
-	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData,
-	{
+	GetObjectSerializer()->DeserializeObjectProperties(AssetData, MaterialInstanceConstant, FJsonPropertyFilter::Remove({
 		"CachedReferencedTextures"
-	}), MaterialInstanceConstant);
+	}));
 
 	TArray<TSharedPtr<FJsonValue>> StaticSwitchParametersObjects;
 	TArray<TSharedPtr<FJsonValue>> StaticComponentMaskParametersObjects;
@@ -65,14 +65,13 @@ bool IPhysicsAssetImporter::Import() {
 	});
 
 	/* Simple data at end ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData,
-	{
+	GetObjectSerializer()->DeserializeObjectProperties(AssetData, PhysicsAsset, FJsonPropertyFilter::Remove({
 		"SkeletalBodySetups",
 		"ConstraintSetup",
 		"BoundsBodies",
 		"ThumbnailInfo",
 		"CollisionDisableTable"
-	}), PhysicsAsset);
+	}));
 
 	/* If the user selected a skeletal mesh in the browser, set it in the physics asset */
 	const USkeletalMesh* SkeletalMesh = GetSelectedAsset<USkeletalMesh>(true);
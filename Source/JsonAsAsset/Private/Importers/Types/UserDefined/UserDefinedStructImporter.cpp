@@ -35,11 +35,10 @@ bool IUserDefinedStructImporter::Import() {
     UUserDefinedStruct* UserDefinedStruct = FStructureEditorUtils::CreateUserDefinedStruct(Package, *AssetName, RF_Standalone | RF_Public | RF_Transactional);
 
     DefaultProperties = AssetData->GetObjectField(TEXT("DefaultProperties"));
-    GetObjectSerializer()->DeserializeObjectProperties(KeepPropertiesShared(AssetData,
-    {
+    GetObjectSerializer()->DeserializeObjectProperties(AssetData, UserDefinedStruct, FJsonPropertyFilter::Keep({
         "Guid",
         "StructFlags"
-    }), UserDefinedStruct);
+    }));
 
     /* Struct Metadata [Editor Only Data] */
     CookedStructMetaData = GetExport("StructCookedMetaData", AllJsonObjects, true);
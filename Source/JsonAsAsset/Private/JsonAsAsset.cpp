@@ -27,6 +27,9 @@
 #include "ISettingsModule.h"
 #include "MessageLogModule.h"
 #include "Styling/SlateIconFinder.h"
+#include "Async/Async.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 /* Settings */
 #include "./Settings/Details/JsonAsAssetSettingsDetails.h"
@@ -44,6 +47,11 @@
 #include "Modules/UI/StyleModule.h"
 #include "Utilities/Compatibility.h"
 #include "Utilities/RemoteUtilities.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+#include "Utilities/Json/JsonImportScope.h"
+#include "Importers/Constructor/ImportManifest.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Benchmark/LocalFetchStandIn.h"
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #ifdef _MSC_VER
@@ -159,6 +167,9 @@ void FJsonAsAssetModule::PluginButtonClicked() {
 	if (OutFileNames.Num() == 0)
 		return;
 
+	/* One profile for all selected files */
+	FImportProfiler::FBatchScope ProfilerBatch;
+
 	for (FString& File : OutFileNames) {
 		/* Clear Message Log */
 		FMessageLogModule& MessageLogModule = FModuleManager::GetModuleChecked<FMessageLogModule>("MessageLog");
@@ -171,25 +182,60 @@ void FJsonAsAssetModule::PluginButtonClicked() {
 }
 
 void FJsonAsAssetModule::StartupModule() {
-    /* Initialize plugin style, reload textures, and register commands */
-    FJsonAsAssetStyle::Initialize();
-    FJsonAsAssetStyle::ReloadTextures();
-    FJsonAsAssetCommands::Register();
+	TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_StartupModule);
 
-    /* Set up plugin command list and map actions */
+    /* Style and commands are registered the first time the toolbar icon is drawn, see GetToolbarIcon */
     PluginCommands = MakeShareable(new FUICommandList);
-    PluginCommands->MapAction(
-        FJsonAsAssetCommands::Get().PluginAction,
-        FExecuteAction::CreateRaw(this, &FJsonAsAssetModule::PluginButtonClicked),
-        FCanExecuteAction()
-    );
 
     /* Register menus on startup */
     UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FJsonAsAssetModule::RegisterMenus));
 
-    /* Check for export directory in settings */
     Settings = GetMutableDefault<UJsonAsAssetSettings>();
-	
+
+    /* Set up message log for JsonAsAsset */
+    {
+        FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
+        FMessageLogInitializationOptions InitOptions;
+        InitOptions.bShowPages = true;
+        InitOptions.bAllowClear = true;
+        InitOptions.bShowFilters = true;
+        MessageLogModule.RegisterLogListing("JsonAsAsset", NSLOCTEXT("JsonAsAsset", "JsonAsAssetLogLabel", "JsonAsAsset"), InitOptions);
+    }
+
+#if ENGINE_UE4
+	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor"); {
+    	TSharedPtr<FExtender> ToolbarExtender = MakeShareable(new FExtender);
+    	ToolbarExtender->AddToolBarExtension("Settings", EExtensionHook::After, PluginCommands, FToolBarExtensionDelegate::CreateRaw(this, &FJsonAsAssetModule::AddToolbarExtension));
+
+    	LevelEditorModule.GetToolBarExtensibilityManager()->AddExtender(ToolbarExtender);
+	}
+#endif
+
+    /* Register custom class layout for settings */
+    FPropertyEditorModule& PropertyModule = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
+    PropertyModule.RegisterCustomClassLayout(UJsonAsAssetSettings::StaticClass()->GetFName(), FOnGetDetailCustomizationInstance::CreateStatic(&FJsonAsAssetSettingsDetails::MakeInstance));
+
+	Plugin = IPluginManager::Get().FindPlugin("JsonAsAsset");
+
+	/* The setup notification and the update check wait for the editor to finish loading */
+	if (GIsRunning) {
+		OnEngineInitComplete();
+	} else {
+		FCoreDelegates::OnFEngineLoopInitComplete.AddRaw(this, &FJsonAsAssetModule::OnEngineInitComplete);
+	}
+}
+
+void FJsonAsAssetModule::OnEngineInitComplete() {
+	TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_OnEngineInitComplete);
+
+	FCoreDelegates::OnFEngineLoopInitComplete.RemoveAll(this);
+
+	/* Only stats and deletes files, kept off the game thread */
+	Async(EAsyncExecution::ThreadPool, [] {
+		FJsonBinaryCache::Trim();
+	});
+
+	/* Check for export directory in settings */
 	if (!IsSetup(Settings)) {
 	    const FText TitleText = LOCTEXT("JsonAsAssetNotificationTitle", "Setup JsonAsAsset Settings");
 	    const FText MessageText = LOCTEXT("JsonAsAssetNotificationText",
@@ -240,32 +286,24 @@ void FJsonAsAssetModule::StartupModule() {
 	    ImportantNotificationPtr.Pin()->SetCompletionState(SNotificationItem::CS_Pending);
 	}
 
-    /* Set up message log for JsonAsAsset */
-    {
-        FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
-        FMessageLogInitializationOptions InitOptions;
-        InitOptions.bShowPages = true;
-        InitOptions.bAllowClear = true;
-        InitOptions.bShowFilters = true;
-        MessageLogModule.RegisterLogListing("JsonAsAsset", NSLOCTEXT("JsonAsAsset", "JsonAsAssetLogLabel", "JsonAsAsset"), InitOptions);
-    }
+	CheckForUpdates();
+}
 
-#if ENGINE_UE4
-	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor"); {
-    	TSharedPtr<FExtender> ToolbarExtender = MakeShareable(new FExtender);
-    	ToolbarExtender->AddToolBarExtension("Settings", EExtensionHook::After, PluginCommands, FToolBarExtensionDelegate::CreateRaw(this, &FJsonAsAssetModule::AddToolbarExtension));
+void FJsonAsAssetModule::InitializeUI() {
+	if (bUIInitialized) return;
 
-    	LevelEditorModule.GetToolBarExtensibilityManager()->AddExtender(ToolbarExtender);
-	}
-#endif
+	TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_InitializeUI);
 
-    /* Register custom class layout for settings */
-    FPropertyEditorModule& PropertyModule = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
-    PropertyModule.RegisterCustomClassLayout(UJsonAsAssetSettings::StaticClass()->GetFName(), FOnGetDetailCustomizationInstance::CreateStatic(&FJsonAsAssetSettingsDetails::MakeInstance));
+	bUIInitialized = true;
 
-	Plugin = IPluginManager::Get().FindPlugin("JsonAsAsset");
-	
-	CheckForUpdates();
+	FJsonAsAssetStyle::Initialize();
+	FJsonAsAssetCommands::Register();
+
+	PluginCommands->MapAction(
+		FJsonAsAssetCommands::Get().PluginAction,
+		FExecuteAction::CreateRaw(this, &FJsonAsAssetModule::PluginButtonClicked),
+		FCanExecuteAction()
+	);
 }
 
 void FJsonAsAssetModule::ShutdownModule() {
@@ -273,9 +311,22 @@ void FJsonAsAssetModule::ShutdownModule() {
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
 
-	/* Shutdown the plugin style and unregister commands */
+	FCoreDelegates::OnFEngineLoopInitComplete.RemoveAll(this);
+
+	/* Exports from recent imports still waiting to be released */
+	FJsonImportScope::Flush();
+
+	/* Manifest changes from the last frame may not be written yet */
+	FImportManifest::Flush();
+
+	FLocalFetchStandIn::Shutdown();
+
+	/* Shutdown the plugin style and unregister commands, both may have never been initialized */
 	FJsonAsAssetStyle::Shutdown();
-	FJsonAsAssetCommands::Unregister();
+
+	if (bUIInitialized) {
+		FJsonAsAssetCommands::Unregister();
+	}
 
 	/* Unregister message log listing if the module is loaded */
 	if (FModuleManager::Get().IsModuleLoaded("MessageLog")) {
@@ -284,6 +335,12 @@ void FJsonAsAssetModule::ShutdownModule() {
 	}
 }
 
+FSlateIcon FJsonAsAssetModule::GetToolbarIcon(const FName StyleName) {
+	InitializeUI();
+
+	return FSlateIcon(FJsonAsAssetStyle::GetStyleSetName(), StyleName);
+}
+
 void FJsonAsAssetModule::RegisterMenus() {
 	FToolMenuOwnerScoped OwnerScoped(this);
 
@@ -308,8 +365,8 @@ void FJsonAsAssetModule::RegisterMenus() {
 		TAttribute<FSlateIcon>::Create(
 			TAttribute<FSlateIcon>::FGetter::CreateLambda([this]() -> FSlateIcon {
 				return !IsSetup(Settings) || !LocalFetchModule::IsSetup(Settings)
-					? FSlateIcon(FJsonAsAssetStyle::Get().GetStyleSetName(), FName("JsonAsAsset.Toolbar.Icon.Warning"))
-					: FSlateIcon(FJsonAsAssetStyle::Get().GetStyleSetName(), FName("JsonAsAsset.Toolbar.Icon"));
+					? GetToolbarIcon(FName("JsonAsAsset.Toolbar.Icon.Warning"))
+					: GetToolbarIcon(FName("JsonAsAsset.Toolbar.Icon"));
 			})
 		),
 		EUserInterfaceActionType::Button
@@ -346,6 +403,13 @@ void FJsonAsAssetModule::RegisterMenus() {
 
 #if ENGINE_UE4
 void FJsonAsAssetModule::AddToolbarExtension(FToolBarBuilder& Builder) {
+	/* Evaluated when the buttons are drawn, not when the toolbar is built */
+	const TAttribute<FSlateIcon> Icon = TAttribute<FSlateIcon>::Create(
+		TAttribute<FSlateIcon>::FGetter::CreateLambda([this]() -> FSlateIcon {
+			return GetToolbarIcon(FName("JsonAsAsset.Toolbar.Icon"));
+		})
+	);
+
 	Builder.AddToolBarButton(
 		FUIAction(
 			FExecuteAction::CreateRaw(this, &FJsonAsAssetModule::PluginButtonClicked),
@@ -364,7 +428,7 @@ void FJsonAsAssetModule::AddToolbarExtension(FToolBarBuilder& Builder) {
 		NAME_None,
 		FText::FromString(Plugin->GetDescriptor().VersionName),
 		LOCTEXT("JsonAsAssetExecuteAction", "Execute JsonAsAsset"),
-		FSlateIcon(FJsonAsAssetStyle::Get().GetStyleSetName(), FName("JsonAsAsset.Toolbar.Icon"))
+		Icon
 	);
 
 	Builder.AddComboButton(
@@ -385,7 +449,7 @@ void FJsonAsAssetModule::AddToolbarExtension(FToolBarBuilder& Builder) {
 		FOnGetContent::CreateRaw(this, &FJsonAsAssetModule::CreateToolbarDropdown),
 		FText::FromString(Plugin->GetDescriptor().VersionName),
 		LOCTEXT("JsonAsAssetButtonTooltip", "Open JsonAsAsset Tool-bar"),
-		FSlateIcon(FJsonAsAssetStyle::Get().GetStyleSetName(), FName("JsonAsAsset.Toolbar.Icon")),
+		Icon,
 		true
 	);
 }
@@ -449,6 +513,8 @@ TSharedRef<SWidget> FJsonAsAssetModule::CreateToolbarDropdown() {
 				TArray<FString> JSONFiles;
 				IFileManager::Get().FindFilesRecursive(JSONFiles, *SelectedFolder, TEXT("*.json"), true, false, false);
 
+				FImportProfiler::FBatchScope ProfilerBatch;
+
 				for (const FString& File : JSONFiles) {
 					IImporter::ImportReference(File);
 				}
@@ -852,12 +918,6 @@ void FJsonAsAssetModule::CheckForUpdates() {
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = HttpModule->CreateRequest();
 #endif
 	
-#if ENGINE_UE5
-	const TSharedPtr<IHttpResponse> Response = FRemoteUtilities::ExecuteRequestSync(Request);
-#else
-	const TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> Response = FRemoteUtilities::ExecuteRequestSync(Request);
-#endif
-	
     Request->SetURL(TEXT("https://api.github.com/repos/JsonAsAsset/JsonAsAsset/releases/latest"));
     Request->SetVerb(TEXT("GET"));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
@@ -894,6 +954,7 @@ void FJsonAsAssetModule::CheckForUpdates() {
     	Versioning.SetValid(true);
     });
 
+    /* Completes on the game thread during a later tick, never blocks the editor */
     Request->ProcessRequest();
 }
 
@@ -1,6 +1,7 @@
 ﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
 
 #include "Modules/Tools/AnimationData.h"
+#include "Modules/Tools/ToolExecutor.h"
 #include "Utilities/EngineUtilities.h"
 #include "Utilities/JsonUtilities.h"
 
@@ -15,12 +16,63 @@
 #include "AnimDataController.h"
 #endif
 
-bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects, const TSharedPtr<FJsonObject>& JsonObject, UAnimSequenceBase* AnimSequenceBase) {
-	FString AssetName = JsonObject->GetStringField(TEXT("Name"));
+namespace {
+	/* A float curve read from the export, added to the animation on the game thread */
+	struct FAnimationFloatCurve {
+		FString DisplayName;
 
-	TArray<TSharedPtr<FJsonValue>> FloatCurves;
-	TArray<TSharedPtr<FJsonValue>> Notifies;
+		/* Used to define if a curve is a curve is metadata or not. */
+		int32 CurveTypeFlags = 0;
+
+		TArray<FRichCurveKey> Keys;
+	};
+
+	/* What the tool's worker stage prepares for Apply */
+	struct FAnimationDataPrepared {
+		TSharedPtr<FJsonObject> Export;
+		TArray<FAnimationFloatCurve> FloatCurves;
+	};
+
+	/* Only reads JSON, runs on a worker */
+	void ReadFloatCurves(const TSharedPtr<FJsonObject>& Properties, const TSharedPtr<FJsonObject>& JsonObject, TArray<FAnimationFloatCurve>& OutCurves) {
+		TArray<TSharedPtr<FJsonValue>> FloatCurves;
+
+		/* Some CUE4Parse versions have different named objects for curves ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+		const TSharedPtr<FJsonObject>* RawCurveData;
 
+		if (Properties->TryGetObjectField(TEXT("RawCurveData"), RawCurveData))
+			FloatCurves = Properties->GetObjectField(TEXT("RawCurveData"))->GetArrayField(TEXT("FloatCurves"));
+
+		if (JsonObject->TryGetObjectField(TEXT("CompressedCurveData"), RawCurveData))
+			FloatCurves = JsonObject->GetObjectField(TEXT("CompressedCurveData"))->GetArrayField(TEXT("FloatCurves"));
+
+		OutCurves.Reserve(FloatCurves.Num());
+
+		for (const TSharedPtr<FJsonValue>& FloatCurveValue : FloatCurves) {
+			const TSharedPtr<FJsonObject> FloatCurveObject = FloatCurveValue->AsObject();
+			FAnimationFloatCurve& FloatCurve = OutCurves.AddDefaulted_GetRef();
+
+			/* Curve Display Name */
+			if (FloatCurveObject->HasField(TEXT("Name"))) {
+				FloatCurve.DisplayName = FloatCurveObject->GetObjectField(TEXT("Name"))->GetStringField(TEXT("DisplayName"));
+			} else {
+				FloatCurve.DisplayName = FloatCurveObject->GetStringField(TEXT("CurveName"));
+			}
+
+			FloatCurve.CurveTypeFlags = FloatCurveObject->GetIntegerField(TEXT("CurveTypeFlags"));
+
+			/* Keys of the track */
+			const TArray<TSharedPtr<FJsonValue>>& Keys = FloatCurveObject->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
+			FloatCurve.Keys.Reserve(Keys.Num());
+
+			for (const TSharedPtr<FJsonValue>& JsonKey : Keys) {
+				FloatCurve.Keys.Add(ObjectToRichCurveKey(JsonKey->AsObject()));
+			}
+		}
+	}
+}
+
+bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects, const TSharedPtr<FJsonObject>& JsonObject, const TArray<FAnimationFloatCurve>& FloatCurves, UAnimSequenceBase* AnimSequenceBase) {
 	if (!AnimSequenceBase) {
 		return false;
 	}
@@ -42,7 +94,7 @@ bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<T
 	ObjectSerializer->DeserializeExports(AllJsonObjects);
 
 	/* Deserialize properties */
-	ObjectSerializer->DeserializeObjectProperties(KeepPropertiesShared(Properties, {
+	ObjectSerializer->DeserializeObjectProperties(Properties, AnimSequenceBase, FJsonPropertyFilter::Keep({
 		"RetargetSource",
 		
 		"AdditiveAnimType",
@@ -57,7 +109,7 @@ bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<T
 		"SlotAnimTracks",
 		"CompositeSections",
 		"Skeleton"
-	}), AnimSequenceBase);
+	}));
 
 	USkeleton* Skeleton = AnimSequenceBase->GetSkeleton();
 	ensure(Skeleton);
@@ -76,27 +128,10 @@ bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<T
 #endif
 #endif
 
-	/* Some CUE4Parse versions have different named objects for curves ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	const TSharedPtr<FJsonObject>* RawCurveData;
-	
-	if (Properties->TryGetObjectField(TEXT("RawCurveData"), RawCurveData))
-		FloatCurves = Properties->GetObjectField(TEXT("RawCurveData"))->GetArrayField(TEXT("FloatCurves"));
-	
-	if (JsonObject->TryGetObjectField(TEXT("CompressedCurveData"), RawCurveData))
-		FloatCurves = JsonObject->GetObjectField(TEXT("CompressedCurveData"))->GetArrayField(TEXT("FloatCurves"));
-
-	/* Import the curves */
-	for (const TSharedPtr<FJsonValue> FloatCurveObject : FloatCurves) {
-		/* Curve Display Name */
-		FString DisplayName = "";
-		if (FloatCurveObject->AsObject()->HasField(TEXT("Name"))) {
-			DisplayName = FloatCurveObject->AsObject()->GetObjectField(TEXT("Name"))->GetStringField(TEXT("DisplayName"));
-		} else {
-			DisplayName = FloatCurveObject->AsObject()->GetStringField(TEXT("CurveName"));
-		}
-
-		/* Used to define if a curve is a curve is metadata or not. */
-		int CurveTypeFlags = FloatCurveObject->AsObject()->GetIntegerField(TEXT("CurveTypeFlags"));
+	/* Import the curves, read from the export by ReadFloatCurves */
+	for (const FAnimationFloatCurve& FloatCurve : FloatCurves) {
+		const FString& DisplayName = FloatCurve.DisplayName;
+		const int CurveTypeFlags = FloatCurve.CurveTypeFlags;
 
 		/* Adding the track name to skeletons differ between Unreal Engine 4 and 5 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #if ENGINE_UE4
@@ -172,13 +207,7 @@ bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<T
 #endif
 
 		/* Keys of the track */
-		TArray<TSharedPtr<FJsonValue>> Keys = FloatCurveObject->AsObject()->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
-
-		for (TSharedPtr<FJsonValue> const JsonKey : Keys) {
-			TSharedPtr<FJsonObject> Key = JsonKey->AsObject();
-
-			FRichCurveKey RichKey = ObjectToRichCurveKey(Key);
-
+		for (const FRichCurveKey& RichKey : FloatCurve.Keys) {
 			/*
 			 * Unreal Engine 5 and Unreal Engine 4
 			 * have different ways of adding curves
@@ -232,36 +261,23 @@ bool ReadAnimationData(const TSharedPtr<FJsonObject>& Properties, const TArray<T
 }
 
 void FToolAnimationData::Execute() {
-	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
+	const TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
 
 	if (AssetDataList.Num() == 0) {
 		return;
 	}
 
-	for (const FAssetData& AssetData : AssetDataList) {
-		if (!AssetData.IsValid()) continue;
-		if (AssetData.AssetClass != "AnimSequence") continue;
-		
-		UObject* Asset = AssetData.GetAsset();
-		if (Asset == nullptr) continue;
-		
-		UAnimSequence* AnimSequence = Cast<UAnimSequence>(Asset);
-		if (AnimSequence == nullptr) continue;
-
-		/* Request to API ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		FString ObjectPath = AssetData.ObjectPath.ToString();
+	FToolStages Stages;
 
-		const TSharedPtr<FJsonObject> Response = FAssetUtilities::API_RequestExports(ObjectPath);
-		if (Response == nullptr || ObjectPath.IsEmpty()) continue;
+	Stages.Filter = [](const FAssetData& AssetData) {
+		return AssetData.AssetClass == "AnimSequence";
+	};
 
-		/* Not found */
-		if (Response->HasField(TEXT("errored"))) {
-			continue;
-		}
+	/* Finding the export and reading its curves only touches JSON */
+	Stages.Transform = [](FToolItem& Item) {
+		const FString AssetName = Item.AssetData.AssetName.ToString();
 
-		TArray<TSharedPtr<FJsonValue>> Exports = Response->GetArrayField(TEXT("jsonOutput"));
-		
-		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		for (const TSharedPtr<FJsonValue>& Export : Item.Exports) {
 			if (!Export.IsValid() || !Export->AsObject().IsValid()) {
 				continue;
 			}
@@ -269,26 +285,38 @@ void FToolAnimationData::Execute() {
 			const TSharedPtr<FJsonObject> JsonObject = Export->AsObject();
 			if (!IsProperExportData(JsonObject)) continue;
 
-			TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
-			const FString Type = JsonObject->GetStringField(TEXT("Type"));
-			const FString Name = JsonObject->GetStringField(TEXT("Name"));
-
-			if (Name != Asset->GetName()) continue;
-
-			if (Type == "AnimSequence") {
-				ReadAnimationData(Properties, Exports, JsonObject, AnimSequence);
-				
-				/* Notification */
-				AppendNotification(
-					FText::FromString("Imported Animation Data: " + AnimSequence->GetName()),
-					FText::FromString(AnimSequence->GetName()),
-					3.5f,
-					FAppStyle::GetBrush("PhysicsAssetEditor.EnableCollision.Small"),
-					SNotificationItem::CS_Success,
-					false,
-					310.0f
-				);
-			}
+			if (JsonObject->GetStringField(TEXT("Name")) != AssetName || JsonObject->GetStringField(TEXT("Type")) != "AnimSequence") continue;
+
+			const TSharedPtr<FAnimationDataPrepared, ESPMode::ThreadSafe> Prepared = MakeShared<FAnimationDataPrepared, ESPMode::ThreadSafe>();
+			Prepared->Export = JsonObject;
+			ReadFloatCurves(JsonObject->GetObjectField(TEXT("Properties")), JsonObject, Prepared->FloatCurves);
+
+			Item.Prepared = Prepared;
+			break;
 		}
-	}
+	};
+
+	Stages.Apply = [](FToolItem& Item) {
+		if (!Item.Prepared.IsValid()) return;
+
+		UAnimSequence* AnimSequence = Cast<UAnimSequence>(Item.AssetData.GetAsset());
+		if (AnimSequence == nullptr) return;
+
+		const FAnimationDataPrepared& Prepared = *StaticCastSharedPtr<FAnimationDataPrepared>(Item.Prepared);
+
+		if (ReadAnimationData(Prepared.Export->GetObjectField(TEXT("Properties")), Item.Exports, Prepared.Export, Prepared.FloatCurves, AnimSequence)) {
+			/* Notification */
+			AppendNotification(
+				FText::FromString("Imported Animation Data: " + AnimSequence->GetName()),
+				FText::FromString(AnimSequence->GetName()),
+				3.5f,
+				FAppStyle::GetBrush("PhysicsAssetEditor.EnableCollision.Small"),
+				SNotificationItem::CS_Success,
+				false,
+				310.0f
+			);
+		}
+	};
+
+	FToolExecutor::Run(FText::FromString("Importing Animation Data"), AssetDataList, Stages);
 }
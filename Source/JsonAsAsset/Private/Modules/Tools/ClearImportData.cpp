@@ -1,22 +1,29 @@
 ﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
 
 #include "Modules/Tools/ClearImportData.h"
+#include "Modules/Tools/ToolExecutor.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Utilities/EngineUtilities.h"
 
 void FToolClearImportData::Execute() {
-	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
+	const TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
 
 	if (AssetDataList.Num() == 0) {
 		return;
 	}
 
-	for (const FAssetData& AssetData : AssetDataList) {
-		if (!AssetData.IsValid()) continue;
-		if (AssetData.AssetClass != "AnimSequence" && AssetData.AssetClass != "SkeletalMesh" && AssetData.AssetClass != "StaticMesh") continue;
-		
-		UObject* Asset = AssetData.GetAsset();
-		if (Asset == nullptr) continue;
+	FToolStages Stages;
+
+	/* Nothing to request, only loading and modifying in budgeted batches */
+	Stages.bFetchExports = false;
+
+	Stages.Filter = [](const FAssetData& AssetData) {
+		return AssetData.AssetClass == "AnimSequence" || AssetData.AssetClass == "SkeletalMesh" || AssetData.AssetClass == "StaticMesh";
+	};
+
+	Stages.Apply = [](FToolItem& Item) {
+		UObject* Asset = Item.AssetData.GetAsset();
+		if (Asset == nullptr) return;
 
 		if (UAnimSequence* AnimSequence = Cast<UAnimSequence>(Asset)) {
 			AnimSequence->AssetImportData->SourceData.SourceFiles.Empty();
@@ -37,5 +44,7 @@ void FToolClearImportData::Execute() {
 		}
 
 		Asset->Modify();
-	}
+	};
+
+	FToolExecutor::Run(FText::FromString("Clearing Import Data"), AssetDataList, Stages);
 }
@@ -1,50 +1,39 @@
 ﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
 
 #include "Modules/Tools/ConvexCollision.h"
+#include "Modules/Tools/ToolExecutor.h"
 
 #include "Engine/StaticMeshSocket.h"
 #include "Utilities/EngineUtilities.h"
 
 #include "PhysicsEngine/BodySetup.h"
 
+namespace {
+	/* Exports the tool's worker stage found for Apply */
+	struct FConvexCollisionPrepared {
+		TSharedPtr<FJsonObject> StaticMeshExport;
+		TArray<TSharedPtr<FJsonObject>> BodySetupProperties;
+	};
+}
+
 void FToolConvexCollision::Execute() {
-	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
+	const TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
 
 	if (AssetDataList.Num() == 0) {
 		return;
 	}
 
-	for (const FAssetData& AssetData : AssetDataList) {
-		if (!AssetData.IsValid()) continue;
-		if (AssetData.AssetClass != "StaticMesh") continue;
-		
-		UObject* Asset = AssetData.GetAsset();
-		if (Asset == nullptr) continue;
-		
-		UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
-		if (StaticMesh == nullptr) continue;
-
-		/* Request to API ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		FString ObjectPath = AssetData.ObjectPath.ToString();
-
-		const TSharedPtr<FJsonObject> Response = FAssetUtilities::API_RequestExports(ObjectPath);
-		if (Response == nullptr || ObjectPath.IsEmpty()) continue;
-
-		/* Not found */
-		if (Response->HasField(TEXT("errored"))) {
-			continue;
-		}
+	FToolStages Stages;
 
-		TArray<TSharedPtr<FJsonValue>> Exports = Response->GetArrayField(TEXT("jsonOutput"));
-		
-		/* Get Body Setup (different in Unreal Engine versions) ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-#if !UE4_27_ONLY_BELOW
-		UBodySetup* BodySetup = StaticMesh->GetBodySetup();
-#else
-		UBodySetup* BodySetup = StaticMesh->BodySetup;
-#endif
+	Stages.Filter = [](const FAssetData& AssetData) {
+		return AssetData.AssetClass == "StaticMesh";
+	};
 
-		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+	/* Finding the exports only touches JSON */
+	Stages.Transform = [](FToolItem& Item) {
+		const TSharedPtr<FConvexCollisionPrepared, ESPMode::ThreadSafe> Prepared = MakeShared<FConvexCollisionPrepared, ESPMode::ThreadSafe>();
+
+		for (const TSharedPtr<FJsonValue>& Export : Item.Exports) {
 			if (!Export.IsValid() || !Export->AsObject().IsValid()) {
 				continue;
 			}
@@ -52,37 +41,64 @@ void FToolConvexCollision::Execute() {
 			const TSharedPtr<FJsonObject> JsonObject = Export->AsObject();
 			if (!IsProperExportData(JsonObject)) continue;
 
-			TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
-			FString Type = JsonObject->GetStringField(TEXT("Type"));
+			const FString Type = JsonObject->GetStringField(TEXT("Type"));
 
 			if (Type == "StaticMesh") {
-				StaticMesh->DistanceFieldSelfShadowBias = 0.0;
+				Prepared->StaticMeshExport = JsonObject;
+			}
+
+			/* Check if the Class matches BodySetup */
+			if (Type == "BodySetup") {
+				Prepared->BodySetupProperties.Add(JsonObject->GetObjectField(TEXT("Properties")));
+			}
+		}
 
-				/* Create an object serializer */
-				UObjectSerializer* ObjectSerializer = CreateObjectSerializer();
+		Item.Prepared = Prepared;
+	};
 
-				StaticMesh->Sockets.Empty();
+	Stages.Apply = [](FToolItem& Item) {
+		if (!Item.Prepared.IsValid()) return;
 
-				ObjectSerializer->SetExportForDeserialization(JsonObject);
-				ObjectSerializer->ParentAsset = StaticMesh;
+		UStaticMesh* StaticMesh = Cast<UStaticMesh>(Item.AssetData.GetAsset());
+		if (StaticMesh == nullptr) return;
 
-				ObjectSerializer->DeserializeExports(Exports);
+		const FConvexCollisionPrepared& Prepared = *StaticCastSharedPtr<FConvexCollisionPrepared>(Item.Prepared);
 
-				for (const FUObjectExport UObjectExport : ObjectSerializer->GetPropertySerializer()->ExportsContainer.Exports) {
-					if (UStaticMeshSocket* Socket = Cast<UStaticMeshSocket>(UObjectExport.Object)) {
-						StaticMesh->AddSocket(Socket);
-					}
+		/* Get Body Setup (different in Unreal Engine versions) ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#if !UE4_27_ONLY_BELOW
+		UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+#else
+		UBodySetup* BodySetup = StaticMesh->BodySetup;
+#endif
+
+		if (const TSharedPtr<FJsonObject>& JsonObject = Prepared.StaticMeshExport) {
+			StaticMesh->DistanceFieldSelfShadowBias = 0.0;
+
+			/* Create an object serializer */
+			UObjectSerializer* ObjectSerializer = CreateObjectSerializer();
+
+			StaticMesh->Sockets.Empty();
+
+			ObjectSerializer->SetExportForDeserialization(JsonObject);
+			ObjectSerializer->ParentAsset = StaticMesh;
+
+			ObjectSerializer->DeserializeExports(Item.Exports);
+
+			for (const FUObjectExport& UObjectExport : ObjectSerializer->GetPropertySerializer()->ExportsContainer.Exports) {
+				if (UStaticMeshSocket* Socket = Cast<UStaticMeshSocket>(UObjectExport.Object)) {
+					StaticMesh->AddSocket(Socket);
 				}
-				
-				ObjectSerializer->DeserializeObjectProperties(RemovePropertiesShared(Properties, {
-					"StaticMaterials",
-					"Sockets"
-				}), StaticMesh);
 			}
 
-			/* Check if the Class matches BodySetup */
-			if (Type != "BodySetup") continue;
-			
+			ObjectSerializer->DeserializeObjectProperties(JsonObject->GetObjectField(TEXT("Properties")), StaticMesh, FJsonPropertyFilter::Remove({
+				"StaticMaterials",
+				"Sockets"
+			}));
+		}
+
+		if (BodySetup == nullptr) return;
+
+		for (const TSharedPtr<FJsonObject>& Properties : Prepared.BodySetupProperties) {
 			/* Empty any collision data */
 			BodySetup->AggGeom.EmptyElements();
 			BodySetup->CollisionTraceFlag = CTF_UseDefault;
@@ -110,5 +126,7 @@ void FToolConvexCollision::Execute() {
 				310.0f
 			);
 		}
-	}
+	};
+
+	FToolExecutor::Run(FText::FromString("Importing Convex Collision"), AssetDataList, Stages);
 }
@@ -1,6 +1,7 @@
 ﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
 
 #include "Modules/Tools/SkeletalMeshData.h"
+#include "Modules/Tools/ToolExecutor.h"
 
 #include <string>
 
@@ -27,6 +28,19 @@
 
 class UClothingAssetCommon;
 
+namespace {
+	struct FSkeletalMaterialSlot {
+		FName MaterialSlotName;
+		TSharedPtr<FJsonObject> Material;
+	};
+
+	/* What the tool's worker stage read from the mesh's export for Apply */
+	struct FSkeletalMeshDataPrepared {
+		TSharedPtr<FJsonObject> Export;
+		TArray<FSkeletalMaterialSlot> MaterialSlots;
+	};
+}
+
 void FSkeletalMeshData::Execute() {
 	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
 
@@ -43,30 +57,17 @@ void FSkeletalMeshData::Execute() {
 		AssetDataList.Add(AssetData);
 	}
 
-	for (const FAssetData& AssetData : AssetDataList) {
-		if (!AssetData.IsValid()) continue;
-		if (AssetData.AssetClass != "SkeletalMesh") continue;
-		
-		UObject* Asset = AssetData.GetAsset();
-		if (Asset == nullptr) continue;
-		
-		USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Asset);
-		if (SkeletalMesh == nullptr) continue;
-
-		/* Request to API ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		FString ObjectPath = AssetData.ObjectPath.ToString();
+	FToolStages Stages;
 
-		const TSharedPtr<FJsonObject> Response = FAssetUtilities::API_RequestExports(ObjectPath);
-		if (Response == nullptr || ObjectPath.IsEmpty()) continue;
+	Stages.Filter = [](const FAssetData& AssetData) {
+		return AssetData.AssetClass == "SkeletalMesh";
+	};
 
-		/* Not found */
-		if (Response->HasField(TEXT("errored"))) {
-			continue;
-		}
+	/* Finding the export and reading its material slots only touches JSON */
+	Stages.Transform = [](FToolItem& Item) {
+		const FString AssetName = Item.AssetData.AssetName.ToString();
 
-		TArray<TSharedPtr<FJsonValue>> Exports = Response->GetArrayField(TEXT("jsonOutput"));
-		
-		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		for (const TSharedPtr<FJsonValue>& Export : Item.Exports) {
 			if (!Export.IsValid() || !Export->AsObject().IsValid()) {
 				continue;
 			}
@@ -74,114 +75,138 @@ void FSkeletalMeshData::Execute() {
 			const TSharedPtr<FJsonObject> JsonObject = Export->AsObject();
 			if (!IsProperExportData(JsonObject)) continue;
 
-			TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
-			const FString Type = JsonObject->GetStringField(TEXT("Type"));
-			const FString Name = JsonObject->GetStringField(TEXT("Name"));
-
-			if (Name != Asset->GetName()) continue;
+			if (JsonObject->GetStringField(TEXT("Name")) != AssetName || JsonObject->GetStringField(TEXT("Type")) != "SkeletalMesh") continue;
 
-			if (Type == "SkeletalMesh") {
-				bool UseClothingAssets = false;
+			const TSharedPtr<FSkeletalMeshDataPrepared, ESPMode::ThreadSafe> Prepared = MakeShared<FSkeletalMeshDataPrepared, ESPMode::ThreadSafe>();
+			Prepared->Export = JsonObject;
 
-				TArray<UClothingAssetBase*> ClothingAssets = SkeletalMesh->GetMeshClothingAssets();
-
-				if (UseClothingAssets) {
-					/* Empty all Clothing Assets */
-					for (UClothingAssetBase* ClothingAsset : ClothingAssets) {
-						ClothingAsset->Modify();
-						ClothingAsset->UnbindFromSkeletalMesh(SkeletalMesh, 0);
-						SkeletalMesh->GetMeshClothingAssets().Remove(ClothingAsset);
-					}
+			for (const TSharedPtr<FJsonValue>& SkeletalMaterialExport : JsonObject->GetArrayField("SkeletalMaterials")) {
+				if (!SkeletalMaterialExport.IsValid() || !SkeletalMaterialExport->AsObject().IsValid()) {
+					continue;
 				}
 
-				TArray<TSharedPtr<FJsonValue>> SkeletalMaterials = JsonObject->GetArrayField("SkeletalMaterials");
+				const TSharedPtr<FJsonObject> SkeletalMaterialObject = SkeletalMaterialExport->AsObject();
 
-				int SkeletalMaterialIndex = 0;
-				
-				for (const TSharedPtr<FJsonValue>& SkeletalMaterialExport : SkeletalMaterials) {
-					if (!SkeletalMaterialExport.IsValid() || !SkeletalMaterialExport->AsObject().IsValid()) {
-						continue;
-					}
+				Prepared->MaterialSlots.Add({
+					FName(*SkeletalMaterialObject->GetStringField("MaterialSlotName")),
+					SkeletalMaterialObject->GetObjectField("Material")
+				});
+			}
 
-					const TSharedPtr<FJsonObject> SkeletalMaterialObject = SkeletalMaterialExport->AsObject();
+			Item.Prepared = Prepared;
+			break;
+		}
+	};
 
-					if (SkeletalMesh->GetMaterials().IsValidIndex(SkeletalMaterialIndex)) {
-						FSkeletalMaterial& MaterialSlot = SkeletalMesh->GetMaterials()[SkeletalMaterialIndex];
-						
-						MaterialSlot.MaterialSlotName = FName(*SkeletalMaterialObject->GetStringField("MaterialSlotName"));
-						MaterialSlot.ImportedMaterialSlotName = MaterialSlot.MaterialSlotName;
+	Stages.Apply = [](FToolItem& Item) {
+		if (!Item.Prepared.IsValid()) return;
 
-						TSharedPtr<FJsonObject> SkeletalMaterial = SkeletalMaterialObject->GetObjectField("Material");
+		USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Item.AssetData.GetAsset());
+		if (SkeletalMesh == nullptr) return;
 
-						IImporter* Importer = new IImporter();
-						
-						TObjectPtr<UObject> LoadedObject;
-						Importer->LoadObject<UObject>(&SkeletalMaterial, LoadedObject);
+		const FSkeletalMeshDataPrepared& Prepared = *StaticCastSharedPtr<FSkeletalMeshDataPrepared>(Item.Prepared);
+		const TSharedPtr<FJsonObject>& JsonObject = Prepared.Export;
+		const TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
 
-						if (IsObjectPtrValid(LoadedObject)) MaterialSlot.MaterialInterface = Cast<UMaterialInterface>(LoadedObject.Get());
-					} else break;
+		bool UseClothingAssets = false;
 
-					SkeletalMaterialIndex++;
-				}
+		TArray<UClothingAssetBase*> ClothingAssets = SkeletalMesh->GetMeshClothingAssets();
 
-				/* Create an object serializer */
-				UObjectSerializer* ObjectSerializer = CreateObjectSerializer();
-
-				ObjectSerializer->SetExportForDeserialization(JsonObject, SkeletalMesh);
-				ObjectSerializer->ParentAsset = SkeletalMesh;
+		if (UseClothingAssets) {
+			/* Empty all Clothing Assets */
+			for (UClothingAssetBase* ClothingAsset : ClothingAssets) {
+				ClothingAsset->Modify();
+				ClothingAsset->UnbindFromSkeletalMesh(SkeletalMesh, 0);
+				SkeletalMesh->GetMeshClothingAssets().Remove(ClothingAsset);
+			}
+		}
 
-				// ObjectSerializer->DeserializeExports(Exports);
-				
-				ObjectSerializer->DeserializeObjectProperties(KeepPropertiesShared(Properties, {
-					// "MeshClothingAssets"
-					"PhysicsAsset",
-					"PostProcessAnimBlueprint",
-					"ShadowPhysicsAsset",
-					"PositiveBoundsExtension",
-					"NegativeBoundsExtension"
-				}), SkeletalMesh);
-				
-				SkeletalMesh->Modify();
+		int SkeletalMaterialIndex = 0;
+		
+		for (const FSkeletalMaterialSlot& SkeletalMaterialSlot : Prepared.MaterialSlots) {
+			if (SkeletalMesh->GetMaterials().IsValidIndex(SkeletalMaterialIndex)) {
+				FSkeletalMaterial& MaterialSlot = SkeletalMesh->GetMaterials()[SkeletalMaterialIndex];
 				
-				if (UseClothingAssets) {
-					ClothingAssets = SkeletalMesh->GetMeshClothingAssets();
+				MaterialSlot.MaterialSlotName = SkeletalMaterialSlot.MaterialSlotName;
+				MaterialSlot.ImportedMaterialSlotName = MaterialSlot.MaterialSlotName;
+
+				TSharedPtr<FJsonObject> SkeletalMaterial = SkeletalMaterialSlot.Material;
+
+				IImporter* Importer = new IImporter();
 				
-					for (UClothingAssetBase* ClothingAssetBase : ClothingAssets) {
-						ClothingAssetBase->Modify();
-
-						if (UClothingAssetCommon* ClothingAsset = Cast<UClothingAssetCommon>(ClothingAssetBase)) {
-							for (FClothLODDataCommon& LodData : ClothingAsset->LodData) {
-								LodData.PointWeightMaps.Empty();
-
-								for (TMap<uint32, FPointWeightMap>::TConstIterator Iterator(LodData.PhysicalMeshData.WeightMaps); Iterator; ++Iterator)
-								{
-									const uint32 Key = Iterator.Key();
-									FPointWeightMap PointWeightMap = Iterator.Value();
-									
-									PointWeightMap.Name = FName(*FString::FromInt(Key));
-									PointWeightMap.CurrentTarget = 1;
-									LodData.PointWeightMaps.Add(PointWeightMap);
-								}
-							}
+				TObjectPtr<UObject> LoadedObject;
+				Importer->LoadObject<UObject>(&SkeletalMaterial, LoadedObject);
+
+				if (IsObjectPtrValid(LoadedObject)) MaterialSlot.MaterialInterface = Cast<UMaterialInterface>(LoadedObject.Get());
+			} else break;
+
+			SkeletalMaterialIndex++;
+		}
+
+		/* Create an object serializer */
+		UObjectSerializer* ObjectSerializer = CreateObjectSerializer();
+
+		ObjectSerializer->SetExportForDeserialization(JsonObject, SkeletalMesh);
+		ObjectSerializer->ParentAsset = SkeletalMesh;
+
+		// ObjectSerializer->DeserializeExports(Exports);
+		
+		ObjectSerializer->DeserializeObjectProperties(Properties, SkeletalMesh, FJsonPropertyFilter::Keep({
+			// "MeshClothingAssets"
+			"PhysicsAsset",
+			"PostProcessAnimBlueprint",
+			"ShadowPhysicsAsset",
+			"PositiveBoundsExtension",
+			"NegativeBoundsExtension"
+		}));
+		
+		SkeletalMesh->Modify();
+		
+		if (UseClothingAssets) {
+			ClothingAssets = SkeletalMesh->GetMeshClothingAssets();
+		
+			for (UClothingAssetBase* ClothingAssetBase : ClothingAssets) {
+				ClothingAssetBase->Modify();
+
+				if (UClothingAssetCommon* ClothingAsset = Cast<UClothingAssetCommon>(ClothingAssetBase)) {
+					for (FClothLODDataCommon& LodData : ClothingAsset->LodData) {
+						LodData.PointWeightMaps.Empty();
+
+						for (TMap<uint32, FPointWeightMap>::TConstIterator Iterator(LodData.PhysicalMeshData.WeightMaps); Iterator; ++Iterator)
+						{
+							const uint32 Key = Iterator.Key();
+							FPointWeightMap PointWeightMap = Iterator.Value();
+							
+							PointWeightMap.Name = FName(*FString::FromInt(Key));
+							PointWeightMap.CurrentTarget = 1;
+							LodData.PointWeightMaps.Add(PointWeightMap);
 						}
 					}
 				}
-
-				const TArray<FAssetData>& Assets = { Asset };
-				const FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
-				ContentBrowserModule.Get().SyncBrowserToAssets(Assets);
-
-				/* Notification */
-				AppendNotification(
-					FText::FromString("Imported Skeletal Mesh Data: " + SkeletalMesh->GetName()),
-					FText::FromString(SkeletalMesh->GetName()),
-					3.5f,
-					FAppStyle::GetBrush("PhysicsAssetEditor.EnableCollision.Small"),
-					SNotificationItem::CS_Success,
-					false,
-					310.0f
-				);
 			}
 		}
+
+		/* Notification */
+		AppendNotification(
+			FText::FromString("Imported Skeletal Mesh Data: " + SkeletalMesh->GetName()),
+			FText::FromString(SkeletalMesh->GetName()),
+			3.5f,
+			FAppStyle::GetBrush("PhysicsAssetEditor.EnableCollision.Small"),
+			SNotificationItem::CS_Success,
+			false,
+			310.0f
+		);
+	};
+
+	/* Single mesh picked in the Content Browser, keep it in view once it was applied */
+	if (SkeletalMeshSelected) {
+		Stages.Complete = [AssetDataList](const bool bCancelled) {
+			if (bCancelled) return;
+
+			const FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+			ContentBrowserModule.Get().SyncBrowserToAssets(AssetDataList);
+		};
 	}
+
+	FToolExecutor::Run(FText::FromString("Importing Skeletal Mesh Data"), AssetDataList, Stages);
 }
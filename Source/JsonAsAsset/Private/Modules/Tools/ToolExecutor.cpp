@@ -0,0 +1,358 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Modules/Tools/ToolExecutor.h"
+
+#include "HttpModule.h"
+#include "Async/Async.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/ExportBatch.h"
+#include "Utilities/RemoteUtilities.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+void FToolExecutor::Run(const FText& ToolName, const TArray<FAssetData>& Assets, const FToolStages& Stages) {
+	const TSharedRef<FToolExecutor, ESPMode::ThreadSafe> Executor = MakeShared<FToolExecutor, ESPMode::ThreadSafe>(ToolName, Stages);
+
+	for (const FAssetData& AssetData : Assets) {
+		if (!AssetData.IsValid()) continue;
+		if (Stages.Filter && !Stages.Filter(AssetData)) continue;
+
+		const FToolItemPtr Item = MakeShared<FToolItem, ESPMode::ThreadSafe>();
+		Item->AssetData = AssetData;
+		Item->ObjectPath = AssetData.ObjectPath.ToString();
+
+		/* Nothing to fetch, straight to the game thread */
+		if (Stages.bFetchExports) {
+			Executor->Pending.Add(Item);
+		} else {
+			Executor->Ready.Enqueue(Item);
+		}
+
+		Executor->Total++;
+	}
+
+	if (Executor->Total == 0) {
+		return;
+	}
+
+	/* Progress notification with a Cancel button */
+	FNotificationInfo Info(ToolName);
+	Info.bFireAndForget = false;
+	Info.bUseLargeFont = true;
+	Info.WidthOverride = FOptionalSize(310.0f);
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		FText::FromString("Cancel"),
+		FText::FromString("Stop after the assets already being applied"),
+		FSimpleDelegate::CreateThreadSafeSP(Executor, &FToolExecutor::Cancel),
+		SNotificationItem::CS_Pending
+	));
+
+	Executor->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+
+	if (Executor->Notification.IsValid()) {
+		Executor->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	Executor->UpdateProgress();
+
+	/* The ticker keeps the executor alive until it finishes */
+#if ENGINE_UE5
+	Executor->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Executor](const float DeltaTime) {
+#else
+	Executor->TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Executor](const float DeltaTime) {
+#endif
+		return Executor->Tick(DeltaTime);
+	}));
+}
+
+FToolExecutor::FToolExecutor(const FText& InToolName, const FToolStages& InStages)
+	: ToolName(InToolName), Stages(InStages), bCancelled(false) {
+}
+
+void FToolExecutor::Cancel() {
+	bCancelled = true;
+}
+
+bool FToolExecutor::Tick(float DeltaTime) {
+	if (bCancelled) {
+		/* Callbacks of cancelled requests still complete their items, so drop the map first */
+		for (const auto& Pair : InFlight) {
+			Pair.Value->OnProcessRequestComplete().Unbind();
+			Pair.Value->CancelRequest();
+		}
+
+		InFlight.Empty();
+		Finish();
+
+		return false;
+	}
+
+	StartFetches();
+	ApplyReady();
+	UpdateProgress();
+
+	if (Completed >= Total) {
+		Finish();
+		return false;
+	}
+
+	return true;
+}
+
+void FToolExecutor::StartFetches() {
+	while (NextPending < Pending.Num()) {
+		const bool bBatched = FExportBatch::IsSupported();
+
+		if (InFlight.Num() >= (bBatched ? FExportBatch::MaxConcurrentRequests : MaxConcurrentFetches)) {
+			break;
+		}
+
+		TArray<FToolItemPtr> Items;
+
+		while (NextPending < Pending.Num() && Items.Num() < (bBatched ? FExportBatch::MaxPathsPerRequest : 1)) {
+			Items.Add(Pending[NextPending]);
+
+			/* The array holds the only other reference, release it once the item is underway */
+			Pending[NextPending].Reset();
+			NextPending++;
+		}
+
+		if (bBatched) {
+			FetchBatch(Items);
+		} else {
+			Fetch(Items[0]);
+		}
+	}
+}
+
+void FToolExecutor::Fetch(const FToolItemPtr& Item) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+#if ENGINE_UE5
+	const TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+#endif
+
+	HttpRequest->SetURL(Settings->LocalFetchUrl + "/api/export?raw=true&path=" + Item->ObjectPath);
+	HttpRequest->SetVerb(TEXT("GET"));
+	FRemoteUtilities::SetTransportHeaders(*HttpRequest);
+
+	const TWeakPtr<FToolExecutor, ESPMode::ThreadSafe> WeakExecutor = AsShared();
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([WeakExecutor, Item](FHttpRequestPtr Request, FHttpResponsePtr Response, const bool bSucceeded) {
+		const TSharedPtr<FToolExecutor, ESPMode::ThreadSafe> Executor = WeakExecutor.Pin();
+		if (!Executor.IsValid()) return;
+
+		Executor->InFlight.Remove(Request.Get());
+
+		if (!bSucceeded || !Response.IsValid()) {
+			Item->bFailed = true;
+			Executor->Ready.Enqueue(Item);
+
+			return;
+		}
+
+		/* Decompressing, parsing and the tool's transform happen off the game thread */
+		Async(EAsyncExecution::TaskGraph, [Executor, Item, Response]() {
+			Executor->Transform(Item, FRemoteUtilities::GetDecodedContent(Response));
+		});
+	});
+
+	InFlight.Add(&HttpRequest.Get(), HttpRequest);
+
+	if (!HttpRequest->ProcessRequest()) {
+		InFlight.Remove(&HttpRequest.Get());
+
+		Item->bFailed = true;
+		Ready.Enqueue(Item);
+	}
+}
+
+void FToolExecutor::FetchBatch(const TArray<FToolItemPtr>& Items) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+#if ENGINE_UE5
+	const TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+#endif
+
+	TArray<FString> Paths;
+	for (const FToolItemPtr& Item : Items) {
+		Paths.Add(Item->ObjectPath);
+	}
+
+	HttpRequest->SetURL(Settings->LocalFetchUrl + FExportBatch::Route);
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("text/plain; charset=utf-8"));
+	HttpRequest->SetContent(FExportBatch::MakeRequestBody(Paths));
+	FRemoteUtilities::SetTransportHeaders(*HttpRequest);
+
+	const TWeakPtr<FToolExecutor, ESPMode::ThreadSafe> WeakExecutor = AsShared();
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([WeakExecutor, Items](FHttpRequestPtr Request, FHttpResponsePtr Response, const bool bSucceeded) {
+		const TSharedPtr<FToolExecutor, ESPMode::ThreadSafe> Executor = WeakExecutor.Pin();
+		if (!Executor.IsValid()) return;
+
+		Executor->InFlight.Remove(Request.Get());
+
+		/* Local Fetch without the batch endpoint, back to one request per asset */
+		if (bSucceeded && Response.IsValid() && Response->GetResponseCode() == 404 && !Response->GetContentType().StartsWith(FExportBatch::ContentType)) {
+			FExportBatch::SetUnsupported();
+			Executor->Pending.Append(Items);
+
+			return;
+		}
+
+		if (!bSucceeded || !Response.IsValid() || !Response->GetContentType().StartsWith(FExportBatch::ContentType)) {
+			for (const FToolItemPtr& Item : Items) {
+				Item->bFailed = true;
+				Executor->Ready.Enqueue(Item);
+			}
+
+			return;
+		}
+
+		Async(EAsyncExecution::TaskGraph, [Executor, Items, Response]() {
+			Executor->ReadBatch(Items, FRemoteUtilities::GetDecodedContent(Response));
+		});
+	});
+
+	InFlight.Add(&HttpRequest.Get(), HttpRequest);
+
+	if (!HttpRequest->ProcessRequest()) {
+		InFlight.Remove(&HttpRequest.Get());
+
+		for (const FToolItemPtr& Item : Items) {
+			Item->bFailed = true;
+			Ready.Enqueue(Item);
+		}
+	}
+}
+
+void FToolExecutor::ReadBatch(const TArray<FToolItemPtr>& Items, const TArray<uint8>& Content) {
+	TArray<bool> Handled;
+	Handled.SetNumZeroed(Items.Num());
+
+	/* Each frame is parsed and transformed as its own task */
+	FExportBatch::ReadFrames(Content, [this, &Items, &Handled](const FString& Path, TArray<uint8>&& Json) {
+		for (int32 Index = 0; Index < Items.Num(); Index++) {
+			if (Handled[Index] || Items[Index]->ObjectPath != Path) continue;
+
+			Handled[Index] = true;
+
+			const TSharedRef<FToolExecutor, ESPMode::ThreadSafe> Executor = AsShared();
+			const FToolItemPtr Item = Items[Index];
+
+			Async(EAsyncExecution::TaskGraph, [Executor, Item, Json = MoveTemp(Json)]() mutable {
+				Executor->Transform(Item, MoveTemp(Json));
+			});
+
+			break;
+		}
+	});
+
+	/* Missing from the response, or the response was cut short */
+	for (int32 Index = 0; Index < Items.Num(); Index++) {
+		if (!Handled[Index]) {
+			Items[Index]->bFailed = true;
+			Ready.Enqueue(Items[Index]);
+		}
+	}
+}
+
+void FToolExecutor::Transform(const FToolItemPtr& Item, TArray<uint8>&& Content) {
+	if (!bCancelled) {
+		const bool bEncoded = FJsonBinaryCache::IsEncoded(Content);
+
+		const TSharedPtr<FJsonValue> Value = bEncoded
+			? FJsonBinaryCache::Decode(MoveTemp(Content))
+			: FMappedJsonReader::Read(FJsonSource::FromBuffer(MoveTemp(Content)), Item->ObjectPath);
+
+		if (Value.IsValid() && Value->Type == EJson::Object) {
+			Item->Response = Value->AsObject();
+		}
+
+		/* Requeued by ApplyReady, the next request asks for JSON */
+		if (!Value.IsValid() && bEncoded && !Item->bRetriedAsJson) {
+			FRemoteUtilities::DisableBinaryTransport();
+			Item->bRetryAsJson = true;
+		}
+		else if (!Item->Response.IsValid()) {
+			Item->bFailed = true;
+		}
+		/* Not found */
+		else if (Item->Response->HasField(TEXT("errored"))) {
+			Item->bFailed = true;
+		} else {
+			Item->Exports = Item->Response->GetArrayField(TEXT("jsonOutput"));
+
+			if (Stages.Transform) {
+				Stages.Transform(*Item);
+			}
+		}
+	}
+
+	Ready.Enqueue(Item);
+}
+
+void FToolExecutor::ApplyReady() {
+	const double StartTime = FPlatformTime::Seconds();
+
+	FToolItemPtr Item;
+
+	/* Always apply at least one item, so a slow asset can't stall the tool */
+	while (Ready.Dequeue(Item)) {
+		if (Item->bRetryAsJson) {
+			Item->bRetryAsJson = false;
+			Item->bRetriedAsJson = true;
+
+			Pending.Add(Item);
+			continue;
+		}
+
+		Completed++;
+
+		if (!Item->bFailed && Stages.Apply) {
+			Stages.Apply(*Item);
+			Applied++;
+		}
+
+		Item.Reset();
+
+		if (bCancelled || FPlatformTime::Seconds() - StartTime > FrameBudgetSeconds) {
+			break;
+		}
+	}
+}
+
+void FToolExecutor::UpdateProgress() const {
+	if (!Notification.IsValid()) return;
+
+	Notification->SetText(FText::Format(
+		FText::FromString("{0} ({1} / {2})"),
+		ToolName,
+		FText::AsNumber(Completed),
+		FText::AsNumber(Total)
+	));
+}
+
+void FToolExecutor::Finish() {
+	UE_LOG(LogJson, Log, TEXT("%s: applied %d of %d assets%s"), *ToolName.ToString(), Applied, Total, bCancelled ? TEXT(" (cancelled)") : TEXT(""));
+
+	if (Notification.IsValid()) {
+		UpdateProgress();
+
+		Notification->SetCompletionState(bCancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Notification->ExpireAndFadeout();
+		Notification.Reset();
+	}
+
+	if (Stages.Complete) {
+		Stages.Complete(bCancelled);
+	}
+}
@@ -34,6 +34,9 @@ void FJsonAsAssetStyle::Initialize() {
 }
 
 void FJsonAsAssetStyle::Shutdown() {
+	/* Never used this session */
+	if (!StyleInstance.IsValid()) return;
+
 	FSlateStyleRegistry::UnRegisterSlateStyle(*StyleInstance);
 	ensure(StyleInstance.IsUnique());
 	StyleInstance.Reset();
@@ -45,6 +48,9 @@ FName FJsonAsAssetStyle::GetStyleSetName() {
 }
 
 const ISlateStyle& FJsonAsAssetStyle::Get() {
+	/* Registered on first use rather than at module startup */
+	Initialize();
+
 	return *StyleInstance;
 }
 
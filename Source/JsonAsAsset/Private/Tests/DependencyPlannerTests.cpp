@@ -0,0 +1,41 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Importers/Constructor/DependencyPlanner.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Benchmark/SyntheticExports.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDependencyPlannerReferencesTest, "JsonAsAsset.Planner.ExportedReferences", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDependencyPlannerReferencesTest::RunTest(const FString& Parameters) {
+	TGuardValue<FString> GameNameGuard(GetMutableDefault<UJsonAsAssetSettings>()->AssetSettings.GameName, FSyntheticExports::GameName);
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FSyntheticExports::TexturedMaterial(TEXT("M_Planner"), { TEXT("T_Planner") }));
+
+	if (!TestTrue(TEXT("Fixture parses"), FJsonSerializer::Deserialize(Reader, Exports))) return false;
+
+	TSet<FString> References;
+	TSet<FString> Textures;
+
+	for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		FDependencyPlanner::CollectReferences(Export, References, Textures);
+	}
+
+	/* The same path LoadObject builds, or the prefetched export is never found */
+	const FString Expected = FString(FSyntheticExports::PackagePath) / TEXT("T_Planner.T_Planner");
+
+	TestEqual(TEXT("Subobjects aren't collected"), References.Num(), 1);
+	TestTrue(TEXT("GameName/Content is collected as /Game"), References.Contains(Expected));
+	TestTrue(TEXT("Textures are keyed the same way"), Textures.Contains(Expected));
+
+	return true;
+}
+
+#endif
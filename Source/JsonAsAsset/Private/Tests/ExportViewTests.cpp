@@ -0,0 +1,91 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+
+#include "Utilities/EngineUtilities.h"
+#include "Utilities/Serializers/Containers/JsonExportView.h"
+
+namespace {
+	/* GetExport as it was before FJsonExportView, the exports copied in and scanned */
+	FORCENOINLINE TSharedPtr<FJsonObject> GetExportByCopy(const FString& Type, TArray<TSharedPtr<FJsonValue>> AllJsonObjects) {
+		for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
+			const TSharedPtr<FJsonObject> ValueObject = Value->AsObject();
+
+			if (ValueObject->GetStringField(TEXT("Type")) == Type) {
+				return ValueObject;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+/* Type lookups on a level sized file, the way importers resolve exports */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExportViewPerfTest, "JsonAsAsset.Perf.ExportView", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FExportViewPerfTest::RunTest(const FString& Parameters) {
+	constexpr int32 NumExports = 20000;
+	constexpr int32 NumTypes = 1000;
+	constexpr int32 NumLookups = 2000;
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	Exports.Reserve(NumExports);
+
+	for (int32 Index = 0; Index < NumExports; Index++) {
+		const TSharedPtr<FJsonObject> Export = MakeShared<FJsonObject>();
+		Export->SetStringField(TEXT("Type"), FString::Printf(TEXT("Type_%d"), Index % NumTypes));
+		Export->SetStringField(TEXT("Name"), FString::Printf(TEXT("Export_%d"), Index));
+
+		Exports.Add(MakeShared<FJsonValueObject>(Export));
+	}
+
+	TArray<FString> Types;
+	FRandomStream Random(1234);
+
+	for (int32 Lookup = 0; Lookup < NumLookups; Lookup++) {
+		Types.Add(FString::Printf(TEXT("Type_%d"), Random.RandRange(0, NumTypes - 1)));
+	}
+
+	TArray<TSharedPtr<FJsonObject>> Copied;
+	TArray<TSharedPtr<FJsonObject>> Viewed;
+	Copied.Reserve(NumLookups);
+	Viewed.Reserve(NumLookups);
+
+	double StartTime = FPlatformTime::Seconds();
+
+	for (const FString& Type : Types) {
+		Copied.Add(GetExportByCopy(Type, Exports));
+	}
+
+	const double CopySeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+
+	/* Includes building the index on the first lookup */
+	const FJsonExportView View(Exports);
+
+	for (const FString& Type : Types) {
+		Viewed.Add(GetExport(Type, View));
+	}
+
+	const double ViewSeconds = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d lookups in %d exports: %.2f ms copied, %.2f ms through the view"), NumLookups, NumExports, CopySeconds * 1000.0, ViewSeconds * 1000.0));
+
+	/* Timings are only reported, they depend on the machine's load */
+	int32 Mismatches = 0;
+
+	for (int32 Lookup = 0; Lookup < NumLookups; Lookup++) {
+		Mismatches += !Viewed[Lookup].IsValid() || Viewed[Lookup] != Copied[Lookup];
+	}
+
+	TestEqual(TEXT("Every lookup finds the same export both ways"), Mismatches, 0);
+
+	return true;
+}
+
+#endif
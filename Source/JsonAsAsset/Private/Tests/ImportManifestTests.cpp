@@ -0,0 +1,57 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Importers/Constructor/ImportManifest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImportManifestDependencyTest, "JsonAsAsset.Manifest.DependencyInvalidation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FImportManifestDependencyTest::RunTest(const FString& Parameters) {
+	const FString Directory = FPaths::AutomationTransientDir() / TEXT("JsonAsAsset") / TEXT("Manifest");
+	const FString Referenced = Directory / TEXT("Plane.json");
+	const FString Referencing = Directory / TEXT("Material.json");
+
+	FFileHelper::SaveStringToFile(TEXT("[]"), *Referenced);
+	FFileHelper::SaveStringToFile(TEXT("[]"), *Referencing);
+
+	/* Packages that always exist stand in for imported ones, the reference uses the exported form of the path */
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(TEXT(R"([{
+		"Type": "Material",
+		"Name": "Material",
+		"Properties": {
+			"Mesh": { "ObjectName": "StaticMesh'Plane'", "ObjectPath": "Engine/Content/BasicShapes/Plane.0" }
+		}
+	}])"));
+
+	FJsonSerializer::Deserialize(Reader, Exports);
+
+	/* Its own manifest, the project's one is never touched */
+	{
+		FImportManifest Manifest(Directory / TEXT("ImportManifest.json"));
+
+		Manifest.Record(Referenced, TArray<TSharedPtr<FJsonValue>>(), { TEXT("/Engine/BasicShapes/Plane") });
+		Manifest.Record(Referencing, Exports, { TEXT("/Engine/BasicShapes/Cube") });
+
+		TestTrue(TEXT("Unchanged files are up to date"), Manifest.IsUpToDate(Referencing));
+
+		/* A different size is enough, the hash cache is keyed on size and timestamp */
+		FFileHelper::SaveStringToFile(TEXT("[ ]"), *Referenced);
+
+		TestFalse(TEXT("Editing a referenced file invalidates the referencing one"), Manifest.IsUpToDate(Referencing));
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,53 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/Paths.h"
+
+#include "Utilities/Benchmark/ImportBenchmark.h"
+#include "Utilities/Benchmark/LocalFetchStandIn.h"
+#include "Utilities/Benchmark/SyntheticExports.h"
+
+/* One test per fixture in the checked-in baseline, see FImportBenchmark */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FImportPerfTest, "JsonAsAsset.Perf.Import", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FImportPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const {
+	TArray<FImportBenchmarkResult> Baseline;
+	FImportBenchmark::ReadResults(FImportBenchmark::GetBaselineFile(), Baseline);
+
+	for (const FImportBenchmarkResult& Entry : Baseline) {
+		OutBeautifiedNames.Add(Entry.Fixture);
+		OutTestCommands.Add(Entry.Fixture);
+	}
+}
+
+bool FImportPerfTest::RunTest(const FString& Parameters) {
+	const FString Directory = FSyntheticExports::GetDefaultDirectory();
+	const FString File = Directory / Parameters + TEXT(".json");
+
+	/* Corpora written before the fixture existed */
+	if (!FPaths::FileExists(File)) {
+		FSyntheticExports::WriteCorpus(Directory, FSyntheticExportOptions());
+	}
+
+	/* Textures, and references to them, are served by the stand-in unless it, or Local Fetch, is already running */
+	const bool bLaunched = !FLocalFetchStandIn::IsRunning() && FLocalFetchStandIn::Launch(FLocalFetchStandInOptions());
+
+	FImportBenchmarkResult Result;
+	const bool bRan = FImportBenchmark::RunFixture(File, Result);
+
+	if (bLaunched) {
+		FLocalFetchStandIn::Shutdown();
+	}
+
+	if (!TestTrue(TEXT("Fixture is imported by the benchmark"), bRan)) return false;
+
+	TestTrue(TEXT("Imported"), Result.bImported);
+	TestEqual(TEXT("Regressions against the baseline"), FImportBenchmark::CompareToBaseline(FImportBenchmark::GetBaselineFile(), { Result }, FImportBenchmark::DefaultThreshold), 0);
+
+	return true;
+}
+
+#endif
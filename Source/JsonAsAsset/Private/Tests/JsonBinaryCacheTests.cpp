@@ -0,0 +1,204 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Utilities/Benchmark/SyntheticExports.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonBinaryCacheCaseTest, "JsonAsAsset.BinaryCache.StringCase", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonBinaryCacheCaseTest::RunTest(const FString& Parameters) {
+	TSharedPtr<FJsonValue> Value;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(TEXT(R"({
+		"Names": [ "Roughness", "roughness", "ROUGHNESS" ],
+		"Roughness": "roughness"
+	})"));
+
+	if (!TestTrue(TEXT("Source parses"), FJsonSerializer::Deserialize(Reader, Value))) return false;
+
+	TArray<uint8> Bytes;
+	FJsonBinaryCache::Encode(Value, Bytes);
+
+	const TSharedPtr<FJsonValue> Decoded = FJsonBinaryCache::Decode(MoveTemp(Bytes));
+	if (!TestTrue(TEXT("Encoded form decodes"), Decoded.IsValid() && Decoded->Type == EJson::Object)) return false;
+
+	const TSharedPtr<FJsonObject> Object = Decoded->AsObject();
+	const TArray<TSharedPtr<FJsonValue>>& Names = Object->GetArrayField(TEXT("Names"));
+
+	if (!TestEqual(TEXT("Every name is kept"), Names.Num(), 3)) return false;
+
+	/* Strings that only differ in case share no entry in the string table */
+	TestTrue(TEXT("Roughness"), Names[0]->AsString().Equals(TEXT("Roughness"), ESearchCase::CaseSensitive));
+	TestTrue(TEXT("roughness"), Names[1]->AsString().Equals(TEXT("roughness"), ESearchCase::CaseSensitive));
+	TestTrue(TEXT("ROUGHNESS"), Names[2]->AsString().Equals(TEXT("ROUGHNESS"), ESearchCase::CaseSensitive));
+
+	TestTrue(TEXT("Keys and values differing in case"), Object->GetStringField(TEXT("Roughness")).Equals(TEXT("roughness"), ESearchCase::CaseSensitive));
+
+	FString Key;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values) {
+		if (Pair.Value->Type == EJson::String) Key = Pair.Key;
+	}
+
+	TestTrue(TEXT("Key keeps its case"), Key.Equals(TEXT("Roughness"), ESearchCase::CaseSensitive));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonBinaryCacheMalformedTest, "JsonAsAsset.BinaryCache.Malformed", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonBinaryCacheMalformedTest::RunTest(const FString& Parameters) {
+	/* Magic, version, no strings, a null root */
+	TArray<uint8> Header;
+	FJsonBinaryCache::Encode(MakeShared<FJsonValueNull>(), Header);
+
+	if (!TestEqual(TEXT("Header size"), Header.Num(), 13)) return false;
+
+	/* More strings than the file could hold, rejected before anything is allocated for them */
+	{
+		TArray<uint8> Bytes = Header;
+		const uint32 StringCount = MAX_uint32;
+		FMemory::Memcpy(Bytes.GetData() + 8, &StringCount, sizeof(StringCount));
+
+		TestFalse(TEXT("Impossible string count"), FJsonBinaryCache::Decode(MoveTemp(Bytes)).IsValid());
+	}
+
+	/* Arrays of one array each, nested far deeper than the reader follows */
+	{
+		TArray<uint8> Bytes = Header;
+		Bytes.SetNum(12);
+
+		for (int32 Level = 0; Level < 100000; Level++) {
+			const uint32 Count = 1;
+
+			Bytes.Add(5);
+			Bytes.Append(reinterpret_cast<const uint8*>(&Count), sizeof(Count));
+		}
+
+		Bytes.Add(0);
+
+		TestFalse(TEXT("Nesting past the depth limit"), FJsonBinaryCache::Decode(MoveTemp(Bytes)).IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonBinaryCacheWireVersionTest, "JsonAsAsset.BinaryCache.WireVersion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonBinaryCacheWireVersionTest::RunTest(const FString& Parameters) {
+	TArray<uint8> Bytes;
+	FJsonBinaryCache::Encode(MakeShared<FJsonValueString>(TEXT("Export")), Bytes);
+
+	uint32 Version = 0;
+	FMemory::Memcpy(&Version, Bytes.GetData() + 4, sizeof(Version));
+
+	TestEqual(TEXT("Sent with the wire version"), Version, FJsonBinaryCache::WireVersion);
+	TestTrue(TEXT("The headers carry the wire version"), FJsonBinaryCache::GetWireContentType().EndsWith(FString::Printf(TEXT("version=%u"), FJsonBinaryCache::WireVersion)));
+
+	/* What a Local Fetch build with another layout sends */
+	Version = FJsonBinaryCache::WireVersion + 1;
+	FMemory::Memcpy(Bytes.GetData() + 4, &Version, sizeof(Version));
+
+	TestTrue(TEXT("Other versions are still recognized as binary"), FJsonBinaryCache::IsEncoded(Bytes));
+	TestFalse(TEXT("Other versions don't decode, so the request is retried as JSON"), FJsonBinaryCache::Decode(MoveTemp(Bytes)).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonBinaryCacheTrimTest, "JsonAsAsset.BinaryCache.Trim", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonBinaryCacheTrimTest::RunTest(const FString& Parameters) {
+	IFileManager& FileManager = IFileManager::Get();
+
+	const FString Directory = FPaths::AutomationTransientDir() / TEXT("JsonAsAsset") / TEXT("ExportCache");
+	const FDateTime Now = FDateTime::UtcNow();
+
+	const auto WriteFile = [&](const FString& Name, const FTimespan Age) {
+		TArray<uint8> Bytes;
+		Bytes.SetNumZeroed(100);
+
+		FFileHelper::SaveArrayToFile(Bytes, *(Directory / Name));
+		FileManager.SetTimeStamp(*(Directory / Name), Now - Age);
+	};
+
+	/* A directory without the version file counts as another version */
+	WriteFile(TEXT("Unversioned.jbin"), FTimespan::Zero());
+	FJsonBinaryCache::Trim(Directory, 150, FTimespan::FromDays(30));
+
+	TestFalse(TEXT("Files of another version are dropped"), FPaths::FileExists(Directory / TEXT("Unversioned.jbin")));
+	TestTrue(TEXT("The version is written"), FPaths::FileExists(Directory / TEXT("Version.txt")));
+
+	WriteFile(TEXT("Stale.jbin"), FTimespan::FromDays(40));
+	WriteFile(TEXT("Older.jbin"), FTimespan::FromDays(2));
+	WriteFile(TEXT("Recent.jbin"), FTimespan::Zero());
+
+	FJsonBinaryCache::Trim(Directory, 150, FTimespan::FromDays(30));
+
+	TestFalse(TEXT("Files unused for longer than the age cap are dropped"), FPaths::FileExists(Directory / TEXT("Stale.jbin")));
+	TestFalse(TEXT("The least recently used file is dropped to fit the size cap"), FPaths::FileExists(Directory / TEXT("Older.jbin")));
+	TestTrue(TEXT("The most recently used file is kept"), FPaths::FileExists(Directory / TEXT("Recent.jbin")));
+
+	FileManager.DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+/* The synthetic corpus read without its cache files (parsed, then cached), then read again from the cache */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonBinaryCachePerfTest, "JsonAsAsset.Perf.ExportCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FJsonBinaryCachePerfTest::RunTest(const FString& Parameters) {
+	const FString Directory = FSyntheticExports::GetDefaultDirectory();
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Directory / TEXT("*.json")), true, false);
+
+	if (Files.Num() == 0) {
+		FSyntheticExports::WriteCorpus(Directory, FSyntheticExportOptions());
+		IFileManager::Get().FindFiles(Files, *(Directory / TEXT("*.json")), true, false);
+	}
+
+	double ColdSeconds = 0.0;
+	double WarmSeconds = 0.0;
+	int32 Mismatches = 0;
+
+	for (const FString& Name : Files) {
+		const FString File = Directory / Name;
+
+		/* Drops this file's entry, the first read parses it and writes the cache */
+		IFileManager::Get().Delete(*(FJsonBinaryCache::GetCacheDirectory() / LexToString(FMD5Hash::HashFile(*File)) + TEXT(".jbin")));
+
+		TArray<TSharedPtr<FJsonValue>> Cold;
+		TArray<TSharedPtr<FJsonValue>> Warm;
+		FJsonReadStats ColdStats;
+		FJsonReadStats WarmStats;
+
+		if (!TestTrue(*(Name + TEXT(" is read")), FJsonBinaryCache::ReadFile(File, Cold, &ColdStats) && FJsonBinaryCache::ReadFile(File, Warm, &WarmStats))) continue;
+
+		TestFalse(*(Name + TEXT(" is parsed the first time")), ColdStats.bFromCache);
+		TestTrue(*(Name + TEXT(" is loaded from the cache the second time")), WarmStats.bFromCache);
+
+		Mismatches += !FJsonValue::CompareEqual(FJsonValueArray(Cold), FJsonValueArray(Warm));
+
+		ColdSeconds += ColdStats.Seconds;
+		WarmSeconds += WarmStats.Seconds;
+
+		AddInfo(FString::Printf(TEXT("%s: %.2f ms cold, %.2f ms warm"), *Name, ColdStats.Seconds * 1000.0, WarmStats.Seconds * 1000.0));
+	}
+
+	AddInfo(FString::Printf(TEXT("%d files: %.2f ms cold, %.2f ms warm"), Files.Num(), ColdSeconds * 1000.0, WarmSeconds * 1000.0));
+
+	/* Timings are only reported, they depend on the machine's load */
+	TestEqual(TEXT("Cached trees match the parsed ones"), Mismatches, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,56 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/Paths.h"
+
+#include "Utilities/Benchmark/SyntheticExports.h"
+#include "Utilities/Json/JsonImportScope.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+/* The synthetic level's tree destroyed in one go, then through the release queue */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExportReleasePerfTest, "JsonAsAsset.Perf.ExportRelease", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FExportReleasePerfTest::RunTest(const FString& Parameters) {
+	const FString Directory = FSyntheticExports::GetDefaultDirectory();
+	const FString File = Directory / TEXT("L_Synthetic.json");
+
+	if (!FPaths::FileExists(File)) {
+		FSyntheticExports::WriteCorpus(Directory, FSyntheticExportOptions());
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	if (!TestTrue(TEXT("The level parses"), FMappedJsonReader::ReadFile(File, Exports))) return true;
+
+	const int32 NumExports = Exports.Num();
+
+	const double StartTime = FPlatformTime::Seconds();
+	Exports.Empty();
+	const double DirectSeconds = FPlatformTime::Seconds() - StartTime;
+
+	/* Anything an earlier import left queued would be counted too */
+	FJsonImportScope::Flush();
+
+	{
+		FJsonImportScope Scope(File);
+		if (!TestTrue(TEXT("The scope reads the level"), Scope.ReadFile())) return true;
+	}
+
+	/* Stands in for the ticker, one batch per frame */
+	while (FJsonImportScope::ReleaseBatch()) {
+	}
+
+	const FJsonReleaseStats& Release = FJsonImportScope::GetLastRelease();
+
+	AddInfo(FString::Printf(TEXT("%d exports: %.2f ms destroyed at once, %.2f ms queued over %d frames, longest frame %.2f ms"),
+		NumExports, DirectSeconds * 1000.0, Release.Seconds * 1000.0, Release.Batches, Release.LongestBatchSeconds * 1000.0));
+
+	/* Timings are only reported, they depend on the machine's load */
+	TestEqual(TEXT("Every export went through the queue"), Release.Exports, NumExports);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,149 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+#include "Utilities/JsonUtilities.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPackedNumbersTest, "JsonAsAsset.Json.PackedNumbers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPackedNumbersTest::RunTest(const FString& Parameters) {
+	const FTCHARToUTF8 Utf8(TEXT(R"({ "Numbers": [1, 2.5, -3], "Mixed": [1, "Two"], "Empty": {} })"));
+
+	TArray<uint8> Bytes;
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+	const TSharedPtr<FJsonValue> Root = FMappedJsonReader::Read(FJsonSource::FromBuffer(MoveTemp(Bytes)), TEXT("PackedNumbers"));
+	if (!TestTrue(TEXT("The document parses"), Root.IsValid())) return true;
+
+	const TSharedPtr<FJsonObject> Object = Root->AsObject();
+	const TSharedPtr<FJsonValue> Numbers = Object->TryGetField(TEXT("Numbers"));
+	const TSharedPtr<FJsonValue> Mixed = Object->TryGetField(TEXT("Mixed"));
+
+	const FJsonValuePackedNumbers* Packed = FJsonValuePackedNumbers::Cast(Numbers);
+	if (!TestNotNull(TEXT("Number arrays are packed"), Packed)) return true;
+
+	TestEqual(TEXT("Packed numbers keep their values"), Packed->GetNumbers()[1], 2.5);
+	TestNull(TEXT("Mixed arrays aren't packed"), FJsonValuePackedNumbers::Cast(Mixed));
+	TestNull(TEXT("Objects aren't packed"), FJsonValuePackedNumbers::Cast(Object->TryGetField(TEXT("Empty"))));
+
+	AddExpectedError(TEXT("used as a 'Object'"), EAutomationExpectedErrorFlags::Contains, 0);
+	TestFalse(TEXT("A packed array read as an object is null"), Numbers->AsObject().IsValid());
+
+	/* Worker threads expanding the same array all get the one expansion */
+	constexpr int32 NumReaders = 64;
+	TArray<const TArray<TSharedPtr<FJsonValue>>*> Expansions;
+	Expansions.SetNumZeroed(NumReaders);
+
+	ParallelFor(NumReaders, [&](const int32 Index) {
+		Expansions[Index] = &Numbers->AsArray();
+	});
+
+	bool bSameExpansion = true;
+
+	for (const TArray<TSharedPtr<FJsonValue>>* Expansion : Expansions) {
+		bSameExpansion &= Expansion == Expansions[0] && Expansion->Num() == 3;
+	}
+
+	TestTrue(TEXT("Concurrent reads share one complete expansion"), bSameExpansion);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMappedJsonDepthTest, "JsonAsAsset.Json.NestingDepth", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMappedJsonDepthTest::RunTest(const FString& Parameters) {
+	const auto Parse = [](const int32 Levels) {
+		TArray<uint8> Bytes;
+		Bytes.Init('[', Levels);
+		Bytes.Add('1');
+
+		for (int32 Level = 0; Level < Levels; Level++) {
+			Bytes.Add(']');
+		}
+
+		return FMappedJsonReader::Read(FJsonSource::FromBuffer(MoveTemp(Bytes)), TEXT("NestingDepth"));
+	};
+
+	TestTrue(TEXT("Nesting up to the limit parses"), Parse(512).IsValid());
+
+	/* Would overflow the stack without the limit */
+	AddExpectedError(TEXT("Nested too deeply"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Nesting past the limit fails"), Parse(1000000).IsValid());
+
+	return true;
+}
+
+/* Pose curve weights read straight from the packed arrays, then through the expanded values */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNumberArrayPerfTest, "JsonAsAsset.Perf.NumberArrays", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FNumberArrayPerfTest::RunTest(const FString& Parameters) {
+	constexpr int32 NumPoses = 2000;
+	constexpr int32 NumCurves = 256;
+
+	FRandomStream Random(1234);
+	FString Document = TEXT("{ \"Poses\": [");
+
+	for (int32 Pose = 0; Pose < NumPoses; Pose++) {
+		Document += Pose == 0 ? TEXT("{ \"CurveData\": [") : TEXT(", { \"CurveData\": [");
+
+		for (int32 Curve = 0; Curve < NumCurves; Curve++) {
+			Document += FString::Printf(Curve == 0 ? TEXT("%.6f") : TEXT(", %.6f"), Random.FRand());
+		}
+
+		Document += TEXT("] }");
+	}
+
+	Document += TEXT("] }");
+
+	const FTCHARToUTF8 Utf8(*Document);
+
+	TArray<uint8> Bytes;
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+	FJsonReadStats Stats;
+	const TSharedPtr<FJsonValue> Root = FMappedJsonReader::Read(FJsonSource::FromBuffer(MoveTemp(Bytes)), TEXT("NumberArrays"), &Stats);
+	if (!TestTrue(TEXT("The document parses"), Root.IsValid())) return true;
+
+	const TArray<TSharedPtr<FJsonValue>>& Poses = Root->AsObject()->GetArrayField(TEXT("Poses"));
+
+	TArray<TArray<float>> Packed;
+	TArray<TArray<float>> Expanded;
+	Packed.SetNum(NumPoses);
+	Expanded.SetNum(NumPoses);
+
+	/* Packed first, the element reads below expand every array */
+	double StartTime = FPlatformTime::Seconds();
+
+	for (int32 Pose = 0; Pose < NumPoses; Pose++) {
+		TryGetNumberArrayField(Poses[Pose]->AsObject(), TEXT("CurveData"), Packed[Pose]);
+	}
+
+	const double PackedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+
+	for (int32 Pose = 0; Pose < NumPoses; Pose++) {
+		for (const TSharedPtr<FJsonValue>& Weight : Poses[Pose]->AsObject()->GetArrayField(TEXT("CurveData"))) {
+			Expanded[Pose].Add(Weight->AsNumber());
+		}
+	}
+
+	const double ExpandedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d poses of %d curves (%lld packed numbers, %lld values): %.2f ms packed, %.2f ms through expanded values"),
+		NumPoses, NumCurves, Stats.PackedNumbers, Stats.Values, PackedSeconds * 1000.0, ExpandedSeconds * 1000.0));
+
+	/* Timings are only reported, they depend on the machine's load */
+	TestEqual(TEXT("Every number is packed"), Stats.PackedNumbers, static_cast<int64>(NumPoses) * NumCurves);
+	TestTrue(TEXT("Both paths read the same weights"), Packed == Expanded);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,112 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "Utilities/Serializers/PropertyUtilities.h"
+#include "Utilities/Serializers/Structs/FallbackStructSerializer.h"
+
+namespace {
+	TSharedRef<FJsonObject> MakeVectorObject(const FVector& Vector) {
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetNumberField(TEXT("X"), Vector.X);
+		Object->SetNumberField(TEXT("Y"), Vector.Y);
+		Object->SetNumberField(TEXT("Z"), Vector.Z);
+
+		return Object;
+	}
+
+	/* Same shape as the transforms in skeleton and level exports */
+	TSharedRef<FJsonObject> MakeTransformObject(const FTransform& Transform) {
+		const FQuat Rotation = Transform.GetRotation();
+
+		const TSharedRef<FJsonObject> RotationObject = MakeShared<FJsonObject>();
+		RotationObject->SetNumberField(TEXT("X"), Rotation.X);
+		RotationObject->SetNumberField(TEXT("Y"), Rotation.Y);
+		RotationObject->SetNumberField(TEXT("Z"), Rotation.Z);
+		RotationObject->SetNumberField(TEXT("W"), Rotation.W);
+
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetObjectField(TEXT("Rotation"), RotationObject);
+		Object->SetObjectField(TEXT("Translation"), MakeVectorObject(Transform.GetTranslation()));
+		Object->SetObjectField(TEXT("Scale3D"), MakeVectorObject(Transform.GetScale3D()));
+
+		return Object;
+	}
+}
+
+/* One million transforms through the registered serializers, then through reflection only */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTransformSerializerPerfTest, "JsonAsAsset.Perf.TransformSerializer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTransformSerializerPerfTest::RunTest(const FString& Parameters) {
+	constexpr int32 NumTransforms = 1000000;
+
+	TArray<FTransform> Expected;
+	TArray<TSharedRef<FJsonObject>> Objects;
+	Expected.Reserve(NumTransforms);
+	Objects.Reserve(NumTransforms);
+
+	FRandomStream Random(1234);
+
+	for (int32 Index = 0; Index < NumTransforms; Index++) {
+		const FTransform Transform(
+			FRotator(Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f)).Quaternion(),
+			Random.GetUnitVector() * Random.FRandRange(0.0f, 10000.0f),
+			FVector(Random.FRandRange(0.1f, 4.0f))
+		);
+
+		Expected.Add(Transform);
+		Objects.Add(MakeTransformObject(Transform));
+	}
+
+	const TStrongObjectPtr<UPropertySerializer> PropertySerializer(NewObject<UPropertySerializer>());
+	UScriptStruct* TransformStruct = TBaseStructure<FTransform>::Get();
+
+	/* The path before the direct serializers, the transform and its components all walked with reflection */
+	const TStrongObjectPtr<UPropertySerializer> ReflectionSerializer(NewObject<UPropertySerializer>());
+	const TSharedPtr<FStructSerializer> FallbackSerializer = MakeShared<FFallbackStructSerializer>(ReflectionSerializer.Get());
+
+	for (UScriptStruct* Struct : { TransformStruct, TBaseStructure<FQuat>::Get(), TBaseStructure<FVector>::Get() }) {
+		ReflectionSerializer->AddStructSerializer(Struct, FallbackSerializer);
+	}
+
+	TArray<FTransform> Direct;
+	TArray<FTransform> Reflected;
+	Direct.SetNum(NumTransforms);
+	Reflected.SetNum(NumTransforms);
+
+	double StartTime = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < NumTransforms; Index++) {
+		PropertySerializer->DeserializeStruct(TransformStruct, Objects[Index], &Direct[Index]);
+	}
+
+	const double DirectSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < NumTransforms; Index++) {
+		ReflectionSerializer->DeserializeStruct(TransformStruct, Objects[Index], &Reflected[Index]);
+	}
+
+	const double ReflectedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d transforms: %.2f ms direct, %.2f ms through reflection"), NumTransforms, DirectSeconds * 1000.0, ReflectedSeconds * 1000.0));
+
+	int32 Mismatches = 0;
+
+	for (int32 Index = 0; Index < NumTransforms; Index++) {
+		Mismatches += !Direct[Index].Equals(Expected[Index], KINDA_SMALL_NUMBER) || !Direct[Index].Equals(Reflected[Index], 0.0f);
+	}
+
+	/* Timings are only reported, they depend on the machine's load */
+	TestEqual(TEXT("Both paths read every transform the same"), Mismatches, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,344 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Utilities/Textures/TextureCreatorUtilities.h"
+
+/*
+ * Fixed blocks decoded through GetDecompressedTextureData, compared byte for byte.
+ *
+ * Expected pixels were produced by the vendored detex, and spot checked against the format
+ * specifications. A change in the block decoders, or in how their output is swizzled, shows here.
+ */
+namespace {
+	/* One block of each of the 14 modes, the rest of the bits random. RGB half floats per pixel, alpha is always 1.0. */
+	struct FBC6HCase {
+		const TCHAR* Name;
+		uint8 Block[16];
+		uint8 RGB[16 * 6];
+	};
+
+	const FBC6HCase BC6HCases[] = {
+		{
+			TEXT("Mode 1"),
+			{ 0x2C, 0xFB, 0x46, 0xD8, 0x96, 0xD6, 0x5D, 0xC0, 0x0E, 0x99, 0x07, 0x6C, 0x48, 0xE9, 0xFE, 0x92 },
+			{
+				0x19, 0x77, 0x5F, 0x11, 0x23, 0x6A, 0x56, 0x77, 0x22, 0x11, 0x23, 0x6A, 0x56, 0x77, 0x22, 0x11,
+				0x23, 0x6A, 0x1C, 0x77, 0x58, 0x11, 0xE5, 0x69, 0x9F, 0x76, 0xD9, 0x11, 0x23, 0x6A, 0x2F, 0x78,
+				0x87, 0x10, 0xED, 0x68, 0xD3, 0x77, 0xCD, 0x10, 0x40, 0x69, 0x5B, 0x76, 0xEC, 0x11, 0x94, 0x6A,
+				0x2F, 0x78, 0x87, 0x10, 0xED, 0x68, 0x5B, 0x76, 0xEC, 0x11, 0x94, 0x6A, 0x1C, 0x77, 0x58, 0x11,
+				0xE5, 0x69, 0xA4, 0x75, 0xD4, 0x12, 0x23, 0x6A, 0xA4, 0x75, 0x77, 0x12, 0x3A, 0x6B, 0x1E, 0x76,
+				0x5A, 0x12, 0x23, 0x6A, 0x5B, 0x76, 0x1D, 0x12, 0x23, 0x6A, 0x5B, 0x76, 0x1D, 0x12, 0x23, 0x6A
+			}
+		},
+		{
+			TEXT("Mode 2"),
+			{ 0xD5, 0x88, 0x52, 0xFA, 0x77, 0x61, 0x16, 0x23, 0x76, 0xF8, 0xD8, 0x94, 0xF9, 0xF3, 0xEC, 0x06 },
+			{
+				0x64, 0x3F, 0xC9, 0x20, 0x56, 0x58, 0xC3, 0x37, 0x46, 0x1B, 0xA1, 0x24, 0xD8, 0x41, 0x8E, 0x22,
+				0xF5, 0x68, 0xC3, 0x37, 0x46, 0x1B, 0xA1, 0x24, 0x37, 0x3A, 0x0C, 0x1D, 0x40, 0x35, 0xD8, 0x41,
+				0x8E, 0x22, 0xF5, 0x68, 0xDC, 0x32, 0xBC, 0x17, 0x64, 0x03, 0xCC, 0x34, 0x44, 0x07, 0xD4, 0x71,
+				0xD8, 0x41, 0x8E, 0x22, 0xF5, 0x68, 0xDC, 0x32, 0xBC, 0x17, 0x64, 0x03, 0xF4, 0x3D, 0x99, 0x05,
+				0xAE, 0x5E, 0xF5, 0x3A, 0x25, 0x06, 0xF2, 0x64, 0xDC, 0x32, 0xBC, 0x17, 0x64, 0x03, 0x4B, 0x36,
+				0xFE, 0x06, 0xB1, 0x6E, 0x74, 0x3F, 0x54, 0x05, 0x8C, 0x5B, 0x74, 0x3F, 0x54, 0x05, 0x8C, 0x5B
+			}
+		},
+		{
+			TEXT("Mode 3"),
+			{ 0xA2, 0xD2, 0xA1, 0x86, 0x0A, 0xAA, 0x70, 0xB1, 0xF3, 0xA6, 0xD3, 0xE2, 0x4D, 0x40, 0xE2, 0xD4 },
+			{
+				0x0D, 0x28, 0x96, 0x13, 0x96, 0x13, 0x18, 0x28, 0xCD, 0x13, 0xAC, 0x13, 0x18, 0x28, 0xCD, 0x13,
+				0xAC, 0x13, 0x0D, 0x28, 0x96, 0x13, 0x96, 0x13, 0xD6, 0x28, 0x77, 0x13, 0xF3, 0x13, 0x7F, 0x28,
+				0x95, 0x13, 0xCC, 0x13, 0xCC, 0x27, 0xD4, 0x13, 0x7B, 0x13, 0xCC, 0x27, 0xD4, 0x13, 0x7B, 0x13,
+				0xA0, 0x27, 0xE3, 0x13, 0x67, 0x13, 0xA0, 0x27, 0xE3, 0x13, 0x67, 0x13, 0xCC, 0x27, 0xD4, 0x13,
+				0x7B, 0x13, 0xCC, 0x27, 0xD4, 0x13, 0x7B, 0x13, 0x1A, 0x28, 0xD9, 0x13, 0xB0, 0x13, 0x0F, 0x28,
+				0xA1, 0x13, 0x9A, 0x13, 0x18, 0x28, 0xCD, 0x13, 0xAC, 0x13, 0x1A, 0x28, 0xD9, 0x13, 0xB0, 0x13
+			}
+		},
+		{
+			TEXT("Mode 4"),
+			{ 0x86, 0x33, 0x34, 0x1A, 0x45, 0xD2, 0x9C, 0x92, 0x13, 0xC3, 0x63, 0x87, 0x03, 0x1E, 0x16, 0x20 },
+			{
+				0xF9, 0x18, 0x53, 0x44, 0x91, 0x27, 0x3A, 0x19, 0x8F, 0x44, 0xA3, 0x27, 0xC5, 0x18, 0xC5, 0x44,
+				0x6D, 0x27, 0xE2, 0x18, 0xB8, 0x44, 0x7A, 0x27, 0xF9, 0x18, 0x53, 0x44, 0x91, 0x27, 0x7D, 0x18,
+				0xB0, 0x44, 0xDE, 0x27, 0xF9, 0x18, 0x53, 0x44, 0x91, 0x27, 0x8D, 0x18, 0xDF, 0x44, 0x53, 0x27,
+				0x3A, 0x19, 0x8F, 0x44, 0xA3, 0x27, 0xC5, 0x18, 0x7A, 0x44, 0xB2, 0x27, 0xF9, 0x18, 0x53, 0x44,
+				0x91, 0x27, 0xC5, 0x18, 0x7A, 0x44, 0xB2, 0x27, 0xA9, 0x18, 0xD2, 0x44, 0x60, 0x27, 0x8D, 0x18,
+				0xDF, 0x44, 0x53, 0x27, 0x8D, 0x18, 0xDF, 0x44, 0x53, 0x27, 0xE8, 0x18, 0x60, 0x44, 0x9C, 0x27
+			}
+		},
+		{
+			TEXT("Mode 5"),
+			{ 0xCA, 0xC4, 0x85, 0xE0, 0xBB, 0x48, 0xD8, 0x0D, 0x16, 0x28, 0x30, 0xC4, 0x78, 0xEE, 0x72, 0xDC },
+			{
+				0x54, 0x5F, 0x32, 0x10, 0x0F, 0x1E, 0x82, 0x5F, 0x3F, 0x10, 0xEF, 0x1D, 0x54, 0x5F, 0x32, 0x10,
+				0x0F, 0x1E, 0x12, 0x5F, 0x5C, 0x10, 0xEC, 0x1D, 0xB2, 0x5F, 0x4C, 0x10, 0xCD, 0x1D, 0x54, 0x5F,
+				0x32, 0x10, 0x0F, 0x1E, 0xC1, 0x5F, 0x51, 0x10, 0xC2, 0x1D, 0x12, 0x5F, 0x5C, 0x10, 0xEC, 0x1D,
+				0xC1, 0x5F, 0x51, 0x10, 0xC2, 0x1D, 0xB2, 0x5F, 0x4C, 0x10, 0xCD, 0x1D, 0xA2, 0x5F, 0x48, 0x10,
+				0xD8, 0x1D, 0x34, 0x5F, 0x1F, 0x10, 0x80, 0x1D, 0x82, 0x5F, 0x3F, 0x10, 0xEF, 0x1D, 0x93, 0x5F,
+				0x44, 0x10, 0xE3, 0x1D, 0x82, 0x5F, 0x3F, 0x10, 0xEF, 0x1D, 0x28, 0x5F, 0x35, 0x10, 0xA7, 0x1D
+			}
+		},
+		{
+			TEXT("Mode 6"),
+			{ 0xAE, 0x77, 0x79, 0xAB, 0xFE, 0xC3, 0x8B, 0x75, 0x5E, 0x6D, 0x9A, 0x66, 0xB3, 0x84, 0xF1, 0x07 },
+			{
+				0xD3, 0x6B, 0x98, 0x3A, 0x74, 0x53, 0xCF, 0x6E, 0x19, 0x37, 0xA9, 0x4F, 0xCF, 0x6E, 0x19, 0x37,
+				0xA9, 0x4F, 0x61, 0x6D, 0x19, 0x37, 0xDD, 0x4F, 0xAF, 0x6B, 0x50, 0x3A, 0xFF, 0x54, 0xAF, 0x6B,
+				0x50, 0x3A, 0xFF, 0x54, 0x96, 0x6C, 0x19, 0x37, 0xFA, 0x4F, 0xDF, 0x6B, 0x19, 0x37, 0x14, 0x50,
+				0xC1, 0x6B, 0x73, 0x3A, 0x3F, 0x54, 0xE5, 0x6B, 0xBB, 0x3A, 0xB5, 0x52, 0xAF, 0x6B, 0x50, 0x3A,
+				0xFF, 0x54, 0x87, 0x6F, 0x19, 0x37, 0x8F, 0x4F, 0xA7, 0x6B, 0x3F, 0x3A, 0x5F, 0x55, 0xA7, 0x6B,
+				0x3F, 0x3A, 0x5F, 0x55, 0xDC, 0x6B, 0xA9, 0x3A, 0x14, 0x53, 0xE5, 0x6B, 0xBB, 0x3A, 0xB5, 0x52
+			}
+		},
+		{
+			TEXT("Mode 7"),
+			{ 0x12, 0xFF, 0xF6, 0x23, 0xB9, 0xFC, 0xFB, 0x69, 0x4B, 0x9C, 0xB1, 0x66, 0xAE, 0xF9, 0xFE, 0xBA },
+			{
+				0x5E, 0x78, 0x0A, 0x73, 0x7A, 0x46, 0xC1, 0x48, 0xD5, 0x72, 0xD1, 0x43, 0x3F, 0x27, 0xB0, 0x72,
+				0xF3, 0x41, 0x95, 0x6C, 0x23, 0x72, 0xAA, 0x44, 0xC1, 0x48, 0xD5, 0x72, 0xD1, 0x43, 0x32, 0x73,
+				0x7C, 0x72, 0xCD, 0x47, 0xE7, 0x71, 0x6B, 0x72, 0x30, 0x47, 0x32, 0x73, 0x7C, 0x72, 0xCD, 0x47,
+				0x9C, 0x70, 0x59, 0x72, 0x93, 0x46, 0x7E, 0x74, 0x8E, 0x72, 0x6A, 0x48, 0xE7, 0x71, 0x6B, 0x72,
+				0x30, 0x47, 0x7E, 0x74, 0x8E, 0x72, 0x6A, 0x48, 0x7E, 0x74, 0x8E, 0x72, 0x6A, 0x48, 0xE0, 0x6D,
+				0x34, 0x72, 0x47, 0x45, 0x7E, 0x74, 0x8E, 0x72, 0x6A, 0x48, 0xE0, 0x6D, 0x34, 0x72, 0x47, 0x45
+			}
+		},
+		{
+			TEXT("Mode 8"),
+			{ 0xD6, 0xE9, 0x57, 0xE0, 0x8C, 0x3A, 0x13, 0x45, 0xDE, 0xC0, 0x06, 0xDF, 0xFB, 0xAF, 0x53, 0xA4 },
+			{
+				0x00, 0x25, 0xB5, 0x56, 0x2C, 0x37, 0x06, 0x26, 0x02, 0x55, 0x7E, 0x36, 0xC7, 0x1F, 0x6A, 0x5F,
+				0xA7, 0x3A, 0xC2, 0x1E, 0x1E, 0x61, 0x56, 0x3B, 0xC7, 0x1F, 0x6A, 0x5F, 0xA7, 0x3A, 0xF5, 0x22,
+				0x1D, 0x5A, 0x89, 0x38, 0xC2, 0x1E, 0x1E, 0x61, 0x56, 0x3B, 0xC2, 0x1E, 0x1E, 0x61, 0x56, 0x3B,
+				0x6D, 0x2A, 0x0E, 0x59, 0x52, 0x30, 0xCD, 0x20, 0xB6, 0x5D, 0xF9, 0x39, 0xC7, 0x1F, 0x6A, 0x5F,
+				0xA7, 0x3A, 0x00, 0x25, 0xB5, 0x56, 0x2C, 0x37, 0x6A, 0x28, 0x79, 0x57, 0xC1, 0x30, 0x4A, 0x2D,
+				0x4E, 0x5B, 0xB6, 0x2F, 0x00, 0x25, 0xB5, 0x56, 0x2C, 0x37, 0xCD, 0x20, 0xB6, 0x5D, 0xF9, 0x39
+			}
+		},
+		{
+			TEXT("Mode 9"),
+			{ 0xDA, 0x4E, 0xF3, 0x91, 0x34, 0x46, 0xDB, 0x44, 0x47, 0x34, 0xF2, 0xB0, 0xDA, 0xB2, 0x3D, 0x6C },
+			{
+				0x66, 0x39, 0xA6, 0x6F, 0x1E, 0x23, 0x46, 0x3D, 0xFA, 0x74, 0xAE, 0x30, 0x31, 0x3B, 0xFC, 0x6A,
+				0x86, 0x22, 0xDA, 0x3A, 0x5A, 0x69, 0x36, 0x20, 0x9F, 0x3A, 0x6C, 0x6E, 0xF4, 0x24, 0x7C, 0x3B,
+				0x8F, 0x6D, 0x40, 0x26, 0xE5, 0x3B, 0x26, 0x6D, 0xDD, 0x26, 0xEE, 0x3C, 0x57, 0x73, 0x5D, 0x2E,
+				0x37, 0x3A, 0xD4, 0x6E, 0x57, 0x24, 0xE5, 0x3B, 0x26, 0x6D, 0xDD, 0x26, 0xE5, 0x3B, 0x26, 0x6D,
+				0xDD, 0x26, 0xE5, 0x3B, 0x26, 0x6D, 0xDD, 0x26, 0x9F, 0x3A, 0x6C, 0x6E, 0xF4, 0x24, 0x66, 0x39,
+				0xA6, 0x6F, 0x1E, 0x23, 0x9F, 0x3A, 0x6C, 0x6E, 0xF4, 0x24, 0x9F, 0x3A, 0x6C, 0x6E, 0xF4, 0x24
+			}
+		},
+		{
+			TEXT("Mode 10"),
+			{ 0xBE, 0x13, 0xB2, 0xCC, 0xED, 0x0D, 0x4B, 0x4A, 0x42, 0x83, 0xBB, 0xE1, 0x47, 0xC4, 0xF1, 0x11 },
+			{
+				0x98, 0x4A, 0x2E, 0x40, 0xC9, 0x40, 0x50, 0x53, 0xE9, 0x3C, 0xE1, 0x3B, 0x50, 0x53, 0xE9, 0x3C,
+				0xE1, 0x3B, 0xE8, 0x40, 0x98, 0x4A, 0xD8, 0x04, 0x28, 0x77, 0x78, 0x2F, 0xB8, 0x27, 0x98, 0x0C,
+				0x68, 0x50, 0x28, 0x39, 0xE8, 0x40, 0x98, 0x4A, 0xD8, 0x04, 0x8C, 0x39, 0x69, 0x4B, 0x33, 0x0C,
+				0x31, 0x32, 0x3A, 0x4C, 0x8E, 0x13, 0xE8, 0x40, 0x98, 0x4A, 0xD8, 0x04, 0x98, 0x0C, 0x68, 0x50,
+				0x28, 0x39, 0x28, 0x39, 0xB8, 0x46, 0x98, 0x4A, 0x98, 0x0C, 0x68, 0x50, 0x28, 0x39, 0x50, 0x53,
+				0xE9, 0x3C, 0xE1, 0x3B, 0x00, 0x5D, 0x47, 0x39, 0x6E, 0x36, 0x28, 0x39, 0xB8, 0x46, 0x98, 0x4A
+			}
+		},
+		{
+			TEXT("Mode 11"),
+			{ 0xE3, 0xFA, 0x81, 0x7D, 0xC7, 0x91, 0x5C, 0xD7, 0x32, 0xCA, 0xC6, 0xF0, 0x04, 0xED, 0xEB, 0x32 },
+			{
+				0xF4, 0x73, 0x30, 0x5D, 0x12, 0x70, 0xE3, 0x6C, 0xA9, 0x5C, 0x14, 0x67, 0x54, 0x55, 0xE6, 0x5A,
+				0x1C, 0x49, 0x0C, 0x4F, 0x6E, 0x5A, 0x1E, 0x41, 0xAE, 0x62, 0xE6, 0x5B, 0x18, 0x5A, 0x0C, 0x4F,
+				0x6E, 0x5A, 0x1E, 0x41, 0x18, 0x77, 0x6C, 0x5D, 0x11, 0x74, 0xD7, 0x44, 0xAB, 0x59, 0x21, 0x34,
+				0xBF, 0x69, 0x6D, 0x5C, 0x15, 0x63, 0x18, 0x77, 0x6C, 0x5D, 0x11, 0x74, 0xE8, 0x4B, 0x32, 0x5A,
+				0x1F, 0x3D, 0xFB, 0x47, 0xE7, 0x59, 0x20, 0x38, 0x30, 0x52, 0xAA, 0x5A, 0x1D, 0x45, 0xFB, 0x47,
+				0xE7, 0x59, 0x20, 0x38, 0x07, 0x70, 0xE5, 0x5C, 0x13, 0x6B, 0xE3, 0x6C, 0xA9, 0x5C, 0x14, 0x67
+			}
+		},
+		{
+			TEXT("Mode 12"),
+			{ 0xC7, 0xE0, 0xAE, 0x9C, 0x8C, 0x12, 0x52, 0x6C, 0xD7, 0xC2, 0x1B, 0x23, 0x76, 0x45, 0x2B, 0x29 },
+			{
+				0xE4, 0x6D, 0xEE, 0x54, 0x68, 0x64, 0x1B, 0x71, 0xA7, 0x5A, 0xFD, 0x6C, 0x95, 0x6D, 0x63, 0x54,
+				0x97, 0x63, 0xCD, 0x70, 0x1B, 0x5A, 0x2C, 0x6C, 0x7F, 0x70, 0x90, 0x59, 0x5B, 0x6B, 0x33, 0x6D,
+				0xB4, 0x53, 0x92, 0x62, 0xE4, 0x6D, 0xEE, 0x54, 0x68, 0x64, 0x95, 0x6D, 0x63, 0x54, 0x97, 0x63,
+				0xE2, 0x6E, 0xB4, 0x56, 0x10, 0x67, 0x31, 0x6F, 0x3F, 0x57, 0xE2, 0x67, 0x80, 0x6E, 0x05, 0x56,
+				0x0B, 0x66, 0x32, 0x6E, 0x7A, 0x55, 0x3A, 0x65, 0x7F, 0x70, 0x90, 0x59, 0x5B, 0x6B, 0x95, 0x6D,
+				0x63, 0x54, 0x97, 0x63, 0xCE, 0x6F, 0x56, 0x58, 0x84, 0x69, 0x95, 0x6D, 0x63, 0x54, 0x97, 0x63
+			}
+		},
+		{
+			TEXT("Mode 13"),
+			{ 0xEB, 0xE4, 0x5C, 0x8A, 0xE7, 0xAA, 0xB5, 0xE2, 0xCE, 0xCD, 0x9E, 0x92, 0xC5, 0x2A, 0xC5, 0xAA },
+			{
+				0xC0, 0x57, 0x70, 0x42, 0x64, 0x1C, 0xAA, 0x58, 0x9D, 0x41, 0xCE, 0x1B, 0xD6, 0x58, 0x74, 0x41,
+				0xB1, 0x1B, 0xAA, 0x58, 0x9D, 0x41, 0xCE, 0x1B, 0x0E, 0x59, 0x42, 0x41, 0x8D, 0x1B, 0x19, 0x58,
+				0x1F, 0x42, 0x2B, 0x1C, 0xD6, 0x56, 0x43, 0x43, 0xFA, 0x1C, 0x19, 0x58, 0x1F, 0x42, 0x2B, 0x1C,
+				0x5C, 0x57, 0xCA, 0x42, 0xA4, 0x1C, 0xAA, 0x58, 0x9D, 0x41, 0xCE, 0x1B, 0x51, 0x58, 0xED, 0x41,
+				0x07, 0x1C, 0xD6, 0x56, 0x43, 0x43, 0xFA, 0x1C, 0x5C, 0x57, 0xCA, 0x42, 0xA4, 0x1C, 0xAA, 0x58,
+				0x9D, 0x41, 0xCE, 0x1B, 0x51, 0x58, 0xED, 0x41, 0x07, 0x1C, 0x51, 0x58, 0xED, 0x41, 0x07, 0x1C
+			}
+		},
+		{
+			TEXT("Mode 14"),
+			{ 0x2F, 0x76, 0xC8, 0x44, 0xFA, 0xBD, 0xAD, 0x1A, 0x61, 0xBD, 0x66, 0xDD, 0x91, 0xD2, 0xBF, 0x8C },
+			{
+				0x59, 0x6C, 0x21, 0x33, 0x7C, 0x5F, 0x59, 0x6C, 0x21, 0x33, 0x7D, 0x5F, 0x59, 0x6C, 0x20, 0x33,
+				0x7E, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C, 0x21, 0x33, 0x7D, 0x5F, 0x59, 0x6C,
+				0x21, 0x33, 0x7D, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F,
+				0x59, 0x6C, 0x21, 0x33, 0x7C, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7D, 0x5F, 0x59, 0x6C, 0x21, 0x33,
+				0x7C, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C,
+				0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7E, 0x5F, 0x59, 0x6C, 0x20, 0x33, 0x7D, 0x5F
+			}
+		}
+	};
+
+	/*
+	 * ETC1 individual and differential blocks, the three modes ETC2 adds through overflowing
+	 * differential colors, and EAC. Pixels as GetDecompressedTextureData writes them: BGRA8,
+	 * R16 for R11, and RG11 rebuilt into a BGRA8 normal.
+	 */
+	struct FETCCase {
+		const TCHAR* Name;
+		EPixelFormat Format;
+		uint8 Block[16];
+		uint8 Pixels[16 * 4];
+	};
+
+	const FETCCase ETCCases[] = {
+		{
+			TEXT("ETC1 individual"), PF_ETC1,
+			{ 0x4C, 0x7A, 0xEC, 0xAD, 0x09, 0x4E, 0xE0, 0x00 },
+			{
+				0xFF, 0x8F, 0x5C, 0xFF, 0xFF, 0x8F, 0x5C, 0xFF, 0xD6, 0x5F, 0x2C, 0xFF, 0xFF, 0x8F, 0x5C, 0xFF,
+				0xD6, 0x5F, 0x2C, 0xFF, 0xFF, 0x8F, 0x5C, 0xFF, 0xFF, 0x8F, 0x5C, 0xFF, 0xFF, 0xC7, 0x94, 0xFF,
+				0xBF, 0x9D, 0xBF, 0xFF, 0xBF, 0x9D, 0xBF, 0xFF, 0xD9, 0xB7, 0xD9, 0xFF, 0xF6, 0xD4, 0xF6, 0xFF,
+				0xBF, 0x9D, 0xBF, 0xFF, 0xD9, 0xB7, 0xD9, 0xFF, 0xBF, 0x9D, 0xBF, 0xFF, 0xF6, 0xD4, 0xF6, 0xFF
+			}
+		},
+		{
+			TEXT("ETC1 differential"), PF_ETC1,
+			{ 0x81, 0x42, 0x23, 0xFB, 0xDC, 0x66, 0x9D, 0x65 },
+			{
+				0xD8, 0xF9, 0xFF, 0xFF, 0x50, 0x71, 0xB3, 0xFF, 0xD8, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+				0x00, 0x13, 0x55, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x71, 0xB3, 0xFF, 0x50, 0x71, 0xB3, 0xFF,
+				0x00, 0x00, 0x22, 0xFF, 0x00, 0x00, 0x22, 0xFF, 0x00, 0x00, 0x22, 0xFF, 0x18, 0x31, 0x6B, 0xFF,
+				0x5A, 0x73, 0xAD, 0xFF, 0x5A, 0x73, 0xAD, 0xFF, 0x00, 0x00, 0x22, 0xFF, 0x00, 0x00, 0x22, 0xFF
+			}
+		},
+		{
+			TEXT("ETC2 T mode"), PF_ETC2_RGB,
+			{ 0xF9, 0x42, 0x23, 0xD6, 0xBD, 0x02, 0x97, 0x96 },
+			{
+				0x22, 0x44, 0xDD, 0xFF, 0xE8, 0x3E, 0x2D, 0xFF, 0xD2, 0x28, 0x17, 0xFF, 0xD2, 0x28, 0x17, 0xFF,
+				0xD2, 0x28, 0x17, 0xFF, 0x22, 0x44, 0xDD, 0xFF, 0xE8, 0x3E, 0x2D, 0xFF, 0xDD, 0x33, 0x22, 0xFF,
+				0xE8, 0x3E, 0x2D, 0xFF, 0x22, 0x44, 0xDD, 0xFF, 0xD2, 0x28, 0x17, 0xFF, 0x22, 0x44, 0xDD, 0xFF,
+				0x22, 0x44, 0xDD, 0xFF, 0xE8, 0x3E, 0x2D, 0xFF, 0xDD, 0x33, 0x22, 0xFF, 0xD2, 0x28, 0x17, 0xFF
+			}
+		},
+		{
+			TEXT("ETC2 H mode"), PF_ETC2_RGB,
+			{ 0x81, 0xF9, 0x23, 0x8B, 0x8C, 0x57, 0xAA, 0xC8 },
+			{
+				0x1C, 0x82, 0x4F, 0xFF, 0x1C, 0x82, 0x4F, 0xFF, 0xB5, 0x3E, 0x0B, 0xFF, 0xB5, 0x3E, 0x0B, 0xFF,
+				0x1C, 0x82, 0x4F, 0xFF, 0xB5, 0x3E, 0x0B, 0xFF, 0x9F, 0x28, 0x00, 0xFF, 0x9F, 0x28, 0x00, 0xFF,
+				0x1C, 0x82, 0x4F, 0xFF, 0x06, 0x6C, 0x39, 0xFF, 0x1C, 0x82, 0x4F, 0xFF, 0xB5, 0x3E, 0x0B, 0xFF,
+				0x9F, 0x28, 0x00, 0xFF, 0x9F, 0x28, 0x00, 0xFF, 0x06, 0x6C, 0x39, 0xFF, 0x06, 0x6C, 0x39, 0xFF
+			}
+		},
+		{
+			TEXT("ETC2 planar mode"), PF_ETC2_RGB,
+			{ 0x81, 0x42, 0xF9, 0x2B, 0x6F, 0x78, 0xC3, 0xBD },
+			{
+				0x69, 0xC3, 0x00, 0xFF, 0x7E, 0xAE, 0x15, 0xFF, 0x94, 0x99, 0x2B, 0xFF, 0xA9, 0x83, 0x40, 0xFF,
+				0x8D, 0x99, 0x06, 0xFF, 0xA2, 0x84, 0x1B, 0xFF, 0xB7, 0x6F, 0x31, 0xFF, 0xCC, 0x5A, 0x46, 0xFF,
+				0xB0, 0x70, 0x0C, 0xFF, 0xC5, 0x5A, 0x21, 0xFF, 0xDB, 0x45, 0x37, 0xFF, 0xF0, 0x30, 0x4C, 0xFF,
+				0xD4, 0x46, 0x12, 0xFF, 0xE9, 0x31, 0x27, 0xFF, 0xFE, 0x1B, 0x3D, 0xFF, 0xFF, 0x06, 0x52, 0xFF
+			}
+		},
+		{
+			TEXT("ETC2 with EAC alpha"), PF_ETC2_RGBA,
+			{ 0x46, 0x33, 0x08, 0x32, 0x9F, 0x7A, 0xB4, 0xF5, 0x41, 0xCA, 0x05, 0x8C, 0xEF, 0xB6, 0xE6, 0xB0 },
+			{
+				0x12, 0xDE, 0x56, 0x40, 0x00, 0x90, 0x08, 0x3A, 0x48, 0x9D, 0x04, 0x1F, 0x62, 0xB7, 0x1E, 0x34,
+				0x00, 0xBA, 0x32, 0x34, 0x00, 0x90, 0x08, 0x34, 0x2B, 0x80, 0x00, 0x55, 0x2B, 0x80, 0x00, 0x1F,
+				0x00, 0xBA, 0x32, 0x40, 0x12, 0xDE, 0x56, 0x1F, 0x2B, 0x80, 0x00, 0x4F, 0x2B, 0x80, 0x00, 0x55,
+				0x12, 0xDE, 0x56, 0x1F, 0x00, 0x90, 0x08, 0x6A, 0x48, 0x9D, 0x04, 0x1F, 0x2B, 0x80, 0x00, 0x4F
+			}
+		},
+		{
+			TEXT("EAC R11, multiplier 0"), PF_ETC2_R11_EAC,
+			{ 0xA4, 0x0E, 0xF0, 0xB7, 0xD1, 0xDF, 0x68, 0xD7 },
+			{
+				0x94, 0xA5, 0x74, 0xA3, 0x74, 0xA5, 0xF4, 0xA4, 0xF4, 0xA4, 0x94, 0xA5, 0x94, 0xA5, 0x74, 0xA3,
+				0xD4, 0xA3, 0x94, 0xA3, 0x74, 0xA5, 0x94, 0xA3, 0x74, 0xA3, 0xD4, 0xA3, 0x74, 0xA5, 0x94, 0xA5
+			}
+		},
+		{
+			TEXT("EAC R11"), PF_ETC2_R11_EAC,
+			{ 0xB3, 0x98, 0xD1, 0x31, 0x2C, 0x63, 0x5D, 0x1A },
+			{
+				0x9E, 0xF2, 0x94, 0xA1, 0x8B, 0x59, 0x9E, 0xF2, 0x97, 0xBC, 0x97, 0xBC, 0x94, 0xA1, 0x97, 0xBC,
+				0x8D, 0x6B, 0x9C, 0xE0, 0x9E, 0xF2, 0x8B, 0x59, 0x8B, 0x59, 0x97, 0xBC, 0x9C, 0xE0, 0x8D, 0x6B
+			}
+		},
+		{
+			TEXT("EAC RG11 normal"), PF_ETC2_RG11_EAC,
+			{ 0xD9, 0x26, 0x9B, 0x1B, 0xD0, 0xC1, 0x09, 0x47, 0x21, 0x1C, 0xF4, 0xC9, 0xFB, 0x57, 0xCA, 0x4D },
+			{
+				0x7F, 0x2A, 0xDF, 0xFF, 0x7F, 0x23, 0xE5, 0xFF, 0x7F, 0x1A, 0xE7, 0xFF, 0x7F, 0x24, 0xDF, 0xFF,
+				0x7F, 0x24, 0xE7, 0xFF, 0x7F, 0x2A, 0xED, 0xFF, 0xA2, 0x24, 0xD1, 0xFF, 0x7F, 0x1D, 0xE5, 0xFF,
+				0x7F, 0x1D, 0xE7, 0xFF, 0xBB, 0x2A, 0xC9, 0xFF, 0xBB, 0x2A, 0xC9, 0xFF, 0x7F, 0x1D, 0xD1, 0xFF,
+				0xAC, 0x23, 0xCB, 0xFF, 0x7F, 0x17, 0xD1, 0xFF, 0xA0, 0x23, 0xD1, 0xFF, 0x7F, 0x24, 0xED, 0xFF
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextureDecodeBC6HTest, "JsonAsAsset.TextureDecode.BC6H", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTextureDecodeBC6HTest::RunTest(const FString& Parameters) {
+	for (const FBC6HCase& Case : BC6HCases) {
+		TArray<uint8> Block(Case.Block, sizeof(Case.Block));
+
+		/* RGBA16F */
+		TArray<uint8> Decoded;
+		Decoded.SetNumZeroed(16 * 8);
+
+		uint8* OutData = Decoded.GetData();
+		FTextureCreatorUtilities::GetDecompressedTextureData(Block.GetData(), OutData, 4, 4, 1, Block.Num(), PF_BC6H);
+
+		bool bMatches = true;
+
+		for (int32 Pixel = 0; Pixel < 16; Pixel++) {
+			const uint16 Alpha = Decoded[Pixel * 8 + 6] | Decoded[Pixel * 8 + 7] << 8;
+
+			bMatches &= FMemory::Memcmp(&Decoded[Pixel * 8], &Case.RGB[Pixel * 6], 6) == 0 && Alpha == 0x3C00;
+		}
+
+		TestTrue(Case.Name, bMatches);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextureDecodeETCTest, "JsonAsAsset.TextureDecode.ETC", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTextureDecodeETCTest::RunTest(const FString& Parameters) {
+	for (const FETCCase& Case : ETCCases) {
+		const int32 BlockSize = GPixelFormats[Case.Format].BlockBytes;
+		const int32 PixelSize = Case.Format == PF_ETC2_R11_EAC ? 2 : 4;
+
+		TArray<uint8> Block(Case.Block, BlockSize);
+
+		TArray<uint8> Decoded;
+		Decoded.SetNumZeroed(16 * PixelSize);
+
+		uint8* OutData = Decoded.GetData();
+		FTextureCreatorUtilities::GetDecompressedTextureData(Block.GetData(), OutData, 4, 4, 1, Block.Num(), Case.Format);
+
+		TestTrue(Case.Name, FMemory::Memcmp(Decoded.GetData(), Case.Pixels, Decoded.Num()) == 0);
+	}
+
+	return true;
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "Importers/Constructor/Importer.h"
 
 #include "Utilities/Textures/TextureCreatorUtilities.h"
+#include "Utilities/Textures/TexturePipeline.h"
+#include "Utilities/Textures/TexturePreview.h"
 
 #include "Curves/CurveLinearColor.h"
 #include "Sound/SoundNode.h"
@@ -20,7 +22,103 @@
 #include "Interfaces/IHttpResponse.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Utilities/ExportBatch.h"
 #include "Utilities/RemoteUtilities.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+#include "Utilities/ImportProfiler.h"
+
+namespace {
+	const TCHAR* DefaultFetchPath = TEXT("/api/export?raw=true&path=");
+
+	/* Responses from PrefetchExports, taken out as they're requested */
+	TMap<FString, TSharedPtr<FJsonObject>> PrefetchedExports;
+
+#if ENGINE_UE5
+	typedef TSharedRef<IHttpRequest> FTextureDataRequestRef;
+#else
+	typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FTextureDataRequestRef;
+#endif
+
+	FTextureDataRequestRef CreateTextureDataRequest(const FString& FetchPath) {
+		const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+		FTextureDataRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetURL(Settings->LocalFetchUrl + "/api/export?path=" + FetchPath);
+		HttpRequest->SetHeader("content-type", "application/octet-stream");
+		HttpRequest->SetVerb(TEXT("GET"));
+
+		return HttpRequest;
+	}
+
+	/* Local Fetch answers with JSON when it has no data for the path */
+	bool IsTextureDataResponse(const FHttpResponsePtr& Response) {
+		return Response.IsValid() && Response->GetResponseCode() == 200 && !Response->GetContentType().StartsWith("application/json; charset=utf-8");
+	}
+
+	bool DownloadTextureData(const FString& FetchPath, TArray<uint8>& OutData) {
+		const FHttpResponsePtr Response = FRemoteUtilities::ExecuteRequestSync(CreateTextureDataRequest(FetchPath));
+		if (!IsTextureDataResponse(Response)) return false;
+
+		OutData = Response->GetContent();
+
+		return OutData.Num() > 0;
+	}
+
+#if UE5_3_BEYOND
+	/* Response body written straight into a buffer sized for the mip, readable while it's still arriving */
+	class FTextureDataStream final : public FArchive {
+	public:
+		explicit FTextureDataStream(const int64 Capacity) {
+			SetIsSaving(true);
+			Buffer.SetNumUninitialized(Capacity);
+		}
+
+		/* HTTP thread */
+		virtual void Serialize(void* Data, const int64 Num) override {
+			const int64 Offset = Written.Load();
+			const int64 Copied = FMath::Clamp<int64>(Buffer.Num() - Offset, 0, Num);
+
+			/* Data past the top mip isn't used */
+			FMemory::Memcpy(Buffer.GetData() + Offset, Data, Copied);
+			Written.Store(Offset + Copied);
+		}
+
+		const uint8* GetData() const { return Buffer.GetData(); }
+		int64 GetWritten() const { return Written.Load(); }
+
+	private:
+		TArray64<uint8> Buffer;
+		TAtomic<int64> Written { 0 };
+	};
+#endif
+
+	/* Decodes rows as they arrive when the engine can stream response bodies, after the download otherwise */
+	bool StreamTextureData(const FString& FetchPath, FTextureRowDecoder& Decoder) {
+		const FTextureDataRequestRef HttpRequest = CreateTextureDataRequest(FetchPath);
+
+#if UE5_3_BEYOND
+		const TSharedRef<FTextureDataStream> Stream = MakeShared<FTextureDataStream>(Decoder.GetPayloadSize());
+		HttpRequest->SetResponseBodyReceiveStream(Stream);
+
+		const FHttpResponsePtr Response = FRemoteUtilities::ExecuteRequestSync(HttpRequest, [&Decoder, &Stream]() {
+			Decoder.Decode(Stream->GetData(), Stream->GetWritten());
+		});
+
+		if (!IsTextureDataResponse(Response)) return false;
+
+		Decoder.Decode(Stream->GetData(), Stream->GetWritten());
+#else
+		const FHttpResponsePtr Response = FRemoteUtilities::ExecuteRequestSync(HttpRequest);
+		if (!IsTextureDataResponse(Response)) return false;
+
+		/* Decoded from the response itself, without copying it first */
+		const TArray<uint8>& Content = Response->GetContent();
+		Decoder.Decode(Content.GetData(), Content.Num());
+#endif
+
+		return Decoder.IsComplete();
+	}
+}
 
 /* CreateAssetPackage Implementations ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 UPackage* FAssetUtilities::CreateAssetPackage(const FString& FullPath) {
@@ -36,6 +134,8 @@ UPackage* FAssetUtilities::CreateAssetPackage(const FString& FullPath) {
 }
 
 UPackage* FAssetUtilities::CreateAssetPackage(const FString& Name, const FString& OutputPath, UPackage*& OutOutermostPkg) {
+	JSONASASSET_PHASE_SCOPE(CreatePackage);
+
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 	
 	FString ModifiablePath = OutputPath;
@@ -202,6 +302,18 @@ bool FAssetUtilities::ConstructAsset(const FString& Path, const FString& Type, T
 	return false;
 }
 
+FString FAssetUtilities::NormalizePackagePath(const FString& PackagePath) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	FString Normalized = PackagePath;
+
+	if (!Settings->AssetSettings.GameName.IsEmpty()) {
+		Normalized = Normalized.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
+	}
+
+	return Normalized.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
+}
+
 bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString& FetchPath, UTexture*& OutTexture) {
 	if (Path.IsEmpty()) {
 		return false;
@@ -224,33 +336,16 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 	UTexture* Texture = nullptr;
 	TArray<uint8> Data = TArray<uint8>();
 
-	/* ~~~~~~~~~~~~~~~ Download Texture Data ~~~~~~~~~~~~ */
-	if (Type != "TextureRenderTarget2D") {
-		FHttpModule* HttpModule = &FHttpModule::Get();
-#if ENGINE_UE5
-		const TSharedRef<IHttpRequest> HttpRequest = HttpModule->CreateRequest();
-#else
-		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = HttpModule->CreateRequest();
-#endif
-
-		HttpRequest->SetURL(Settings->LocalFetchUrl + "/api/export?path=" + FetchPath);
-		HttpRequest->SetHeader("content-type", "application/octet-stream");
-		HttpRequest->SetVerb(TEXT("GET"));
-
-#if ENGINE_UE5
-		const TSharedPtr<IHttpResponse> HttpResponse = FRemoteUtilities::ExecuteRequestSync(HttpRequest);
-#else
-		const TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> HttpResponse = FRemoteUtilities::ExecuteRequestSync(HttpRequest);
-#endif
-		if (!HttpResponse.IsValid() || HttpResponse->GetResponseCode() != 200)
-			return false;
+	/* Every mip is decoded at once, from the whole payload */
+	const bool bImportMips = Type == "Texture2D" && FTextureCreatorUtilities::GetNumImportedMips(JsonExport) > 1;
 
-		if (HttpResponse->GetContentType().StartsWith("application/json; charset=utf-8")) {
-			return false;
-		}
+	/* Kept as it is for the platform data, from the whole payload too */
+	const bool bPreview = Type == "Texture2D" && FTexturePreview::CanPassthrough(JsonExport);
 
-		Data = HttpResponse->GetContent();
-		if (Data.Num() == 0) {
+	/* ~~~~~~~~~~~~~~~ Download Texture Data ~~~~~~~~~~~~ */
+	/* Texture2D data is downloaded while creating it, so it can be decoded as it arrives */
+	if (Type != "TextureRenderTarget2D" && (Type != "Texture2D" || bImportMips || bPreview)) {
+		if (!DownloadTextureData(FetchPath, Data)) {
 			return false;
 		}
 	}
@@ -266,8 +361,18 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 
 	const FTextureCreatorUtilities TextureCreator = FTextureCreatorUtilities(AssetName, Path, Package, OutermostPkg);
 
-	if (Type == "Texture2D") {
+	if (bPreview) {
+		TextureCreator.CreatePreviewTexture2D(Texture, Data, JsonExport);
+	} else if (bImportMips) {
 		TextureCreator.CreateTexture2D(Texture, Data, JsonExport);
+	} else if (Type == "Texture2D") {
+		/* Decoded in the background when the import queued it, see FTexturePipeline */
+		TArray64<uint8> Decoded;
+		const bool bDecoded = FTexturePipeline::Take(FetchPath, Decoded);
+
+		TextureCreator.CreateTexture2D(Texture, [&FetchPath, &Decoded, bDecoded](FTextureRowDecoder& Decoder) {
+			return (bDecoded && Decoder.SetDecoded(Decoded.GetData(), Decoded.Num())) || StreamTextureData(FetchPath, Decoder);
+		}, JsonExport);
 	}
 	if (Type == "TextureCube") {
 		TextureCreator.CreateTextureCube(Texture, Data, JsonExport);
@@ -315,40 +420,77 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 }
 
 TSharedPtr<FJsonObject> FAssetUtilities::API_RequestExports(const FString& Path, const FString& FetchPath) {
-	FHttpModule* HttpModule = &FHttpModule::Get();
+	/* Fetched ahead of time in a batch */
+	if (FetchPath == DefaultFetchPath) {
+		TSharedPtr<FJsonObject> Prefetched;
 
-#if ENGINE_UE5
-	const TSharedRef<IHttpRequest> HttpRequest = HttpModule->CreateRequest();
-#else
-	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = HttpModule->CreateRequest();
-#endif
+		if (PrefetchedExports.RemoveAndCopyValue(Path, Prefetched)) {
+			return Prefetched;
+		}
+	}
 
-	FString PackagePath;
-	FString AssetName;
-	Path.Split(".", &PackagePath, &AssetName);
+	FHttpModule* HttpModule = &FHttpModule::Get();
 
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
+	TSharedPtr<FJsonValue> JsonValue;
+
+	/* A binary response that doesn't decode is asked for again as JSON */
+	for (int32 Attempt = 0; Attempt < 2; Attempt++) {
 #if ENGINE_UE5
-	const TSharedRef<IHttpRequest> NewRequest = HttpModule->CreateRequest();
+		const TSharedRef<IHttpRequest> NewRequest = HttpModule->CreateRequest();
 #else
-	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> NewRequest = HttpModule->CreateRequest();
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> NewRequest = HttpModule->CreateRequest();
 #endif
-	NewRequest->SetURL(Settings->LocalFetchUrl + FetchPath + Path);
-	NewRequest->SetVerb(TEXT("GET"));
+		NewRequest->SetURL(Settings->LocalFetchUrl + FetchPath + Path);
+		NewRequest->SetVerb(TEXT("GET"));
+		FRemoteUtilities::SetTransportHeaders(*NewRequest);
 
 #if ENGINE_UE5
-	const TSharedPtr<IHttpResponse> NewResponse = FRemoteUtilities::ExecuteRequestSync(NewRequest);
+		const TSharedPtr<IHttpResponse> NewResponse = FRemoteUtilities::ExecuteRequestSync(NewRequest);
 #else
-	const TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> NewResponse = FRemoteUtilities::ExecuteRequestSync(NewRequest);
+		const TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> NewResponse = FRemoteUtilities::ExecuteRequestSync(NewRequest);
 #endif
-	if (!NewResponse.IsValid()) return TSharedPtr<FJsonObject>();
+		if (!NewResponse.IsValid()) return TSharedPtr<FJsonObject>();
+
+		/* Responses for shared parents come back byte for byte the same, those are loaded from the export cache */
+		TArray<uint8> Content = FRemoteUtilities::GetDecodedContent(NewResponse);
+		const bool bEncoded = FJsonBinaryCache::IsEncoded(Content);
+
+		{
+			JSONASASSET_PHASE_SCOPE(Parse);
+			JsonValue = FJsonBinaryCache::ReadBuffer(MoveTemp(Content), Path);
+		}
+
+		if (JsonValue.IsValid() || !bEncoded) break;
+
+		FRemoteUtilities::DisableBinaryTransport();
+	}
 
-	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(NewResponse->GetContentAsString());
-	TSharedPtr<FJsonObject> JsonObject;
-	if (FJsonSerializer::Deserialize(JsonReader, JsonObject)) {
-		return JsonObject;
+	if (JsonValue.IsValid() && JsonValue->Type == EJson::Object) {
+		return JsonValue->AsObject();
 	}
 
 	return TSharedPtr<FJsonObject>();
 }
+
+void FAssetUtilities::PrefetchExports(const TArray<FString>& Paths) {
+	TArray<FString> Missing;
+
+	for (const FString& Path : Paths) {
+		if (!PrefetchedExports.Contains(Path)) {
+			Missing.AddUnique(Path);
+		}
+	}
+
+	/* Paths not in the response are requested on their own later, as before */
+	FExportBatch::RequestExports(Missing, PrefetchedExports);
+}
+
+void FAssetUtilities::ClearPrefetchedExports() {
+	PrefetchedExports.Empty();
+}
+
+TSharedPtr<FJsonObject> FAssetUtilities::FindPrefetchedExport(const FString& Path) {
+	return PrefetchedExports.FindRef(Path);
+}
@@ -0,0 +1,352 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Benchmark/ImportBenchmark.h"
+
+#include "HttpModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/Benchmark/LocalFetchStandIn.h"
+#include "Utilities/Benchmark/SyntheticExports.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+#include "Utilities/Json/MappedJsonReader.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/RemoteUtilities.h"
+
+namespace {
+	double UsedPhysicalMB() {
+		return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+
+	double PeakPhysicalMB() {
+		return FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0);
+	}
+}
+
+TArray<FImportBenchmarkResult> FImportBenchmark::Run(const FString& Directory) {
+	TArray<FImportBenchmarkResult> Results;
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Directory / TEXT("*.json")), true, false);
+	Files.Sort();
+
+	/* Everything in one profile, when profiling is enabled */
+	FImportProfiler::FBatchScope ProfilerBatch;
+
+	for (const FString& FileName : Files) {
+		FImportBenchmarkResult Result;
+
+		if (RunFixture(Directory / FileName, Result)) {
+			Results.Add(MoveTemp(Result));
+		}
+	}
+
+	return Results;
+}
+
+bool FImportBenchmark::RunFixture(const FString& File, FImportBenchmarkResult& OutResult) {
+	/* References to other fixtures are exported as "GameName/Content/Path", like Local Fetch's game would */
+	TGuardValue<FString> GameNameGuard(GetMutableDefault<UJsonAsAssetSettings>()->AssetSettings.GameName, FSyntheticExports::GameName);
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+
+	const double MemoryBefore = UsedPhysicalMB();
+	const double StartTime = FPlatformTime::Seconds();
+
+	/* Parsed directly, the export cache would make every run after the first a warm load */
+	if (!FMappedJsonReader::ReadFile(File, Exports) || Exports.Num() == 0) return false;
+
+	/* Fixtures for other benchmarks, like the level used by the transport benchmark */
+	TArray<FString> Types;
+	for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		Types.AddUnique(Export->AsObject()->GetStringField(TEXT("Type")));
+	}
+
+	if (!IImporter::CanImportAny(Types)) return false;
+
+	/* Textures need their payload from Local Fetch, the stand-in serves it */
+	const bool bTexture = Exports[0]->AsObject()->GetStringField(TEXT("Type")).StartsWith(TEXT("Texture"));
+	if (bTexture && !FLocalFetchStandIn::IsRunning()) return false;
+
+	OutResult.Fixture = FPaths::GetBaseFilename(File);
+
+	/* Content path instead of the file path, so fixtures always land in the same folder */
+	const FString PackagePath = FString(FSyntheticExports::PackagePath) / OutResult.Fixture;
+
+	if (bTexture) {
+		const FString ObjectPath = PackagePath + TEXT(".") + OutResult.Fixture;
+
+		UTexture* Texture = nullptr;
+		OutResult.bImported = FAssetUtilities::Construct_TypeTexture(ObjectPath, ObjectPath, Texture);
+	} else {
+		OutResult.bImported = IImporter::ReadExportsAndImport(Exports, PackagePath, true);
+	}
+
+	Exports.Empty();
+
+	OutResult.Seconds = FPlatformTime::Seconds() - StartTime;
+	OutResult.MemoryDeltaMB = FMath::Max(0.0, UsedPhysicalMB() - MemoryBefore);
+	OutResult.PeakMemoryMB = PeakPhysicalMB();
+
+	UE_LOG(LogJson, Display, TEXT("Benchmark %s: %s in %.1f ms, +%.1f MB (peak %.1f MB)"), *OutResult.Fixture,
+		OutResult.bImported ? TEXT("imported") : TEXT("failed"), OutResult.Seconds * 1000.0, OutResult.MemoryDeltaMB, OutResult.PeakMemoryMB);
+
+	return true;
+}
+
+int32 FImportBenchmark::CompareToBaseline(const FString& BaselineFile, const TArray<FImportBenchmarkResult>& Results, const float Threshold) {
+	TArray<FImportBenchmarkResult> Baseline;
+
+	if (!ReadResults(BaselineFile, Baseline)) {
+		UE_LOG(LogJson, Warning, TEXT("No benchmark baseline at \"%s\", run JsonAsAsset.Benchmark -WriteBaseline to create one"), *BaselineFile);
+		return 0;
+	}
+
+	int32 Regressions = 0;
+
+	for (const FImportBenchmarkResult& Result : Results) {
+		const FImportBenchmarkResult* Expected = Baseline.FindByPredicate([&Result](const FImportBenchmarkResult& Entry) {
+			return Entry.Fixture == Result.Fixture;
+		});
+
+		if (Expected == nullptr) continue;
+
+		if (Expected->bImported && !Result.bImported) {
+			UE_LOG(LogJson, Error, TEXT("Benchmark %s: failed to import, the baseline imported it"), *Result.Fixture);
+			Regressions++;
+		}
+
+		if (Result.Seconds > Expected->Seconds * (1.0 + Threshold)) {
+			UE_LOG(LogJson, Error, TEXT("Benchmark %s: %.1f ms, baseline %.1f ms (+%.0f%%)"), *Result.Fixture,
+				Result.Seconds * 1000.0, Expected->Seconds * 1000.0, (Result.Seconds / Expected->Seconds - 1.0) * 100.0);
+			Regressions++;
+		}
+
+		/* Small deltas are mostly allocator noise */
+		if (Result.MemoryDeltaMB > Expected->MemoryDeltaMB * (1.0 + Threshold) + 16.0) {
+			UE_LOG(LogJson, Error, TEXT("Benchmark %s: +%.1f MB, baseline +%.1f MB"), *Result.Fixture, Result.MemoryDeltaMB, Expected->MemoryDeltaMB);
+			Regressions++;
+		}
+	}
+
+	return Regressions;
+}
+
+bool FImportBenchmark::WriteResults(const FString& File, const TArray<FImportBenchmarkResult>& Results) {
+	FString Csv = TEXT("Fixture,Imported,Seconds,MemoryDeltaMB,PeakMemoryMB") LINE_TERMINATOR;
+
+	for (const FImportBenchmarkResult& Result : Results) {
+		Csv += FString::Printf(TEXT("%s,%d,%.6f,%.3f,%.3f") LINE_TERMINATOR, *Result.Fixture, Result.bImported ? 1 : 0, Result.Seconds, Result.MemoryDeltaMB, Result.PeakMemoryMB);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *File);
+}
+
+bool FImportBenchmark::ReadResults(const FString& File, TArray<FImportBenchmarkResult>& OutResults) {
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *File)) return false;
+
+	/* Skip the header */
+	for (int32 Index = 1; Index < Lines.Num(); Index++) {
+		TArray<FString> Columns;
+		Lines[Index].ParseIntoArray(Columns, TEXT(","));
+
+		if (Columns.Num() < 5) continue;
+
+		FImportBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Fixture = Columns[0];
+		Result.bImported = Columns[1] == TEXT("1");
+		Result.Seconds = FCString::Atod(*Columns[2]);
+		Result.MemoryDeltaMB = FCString::Atod(*Columns[3]);
+		Result.PeakMemoryMB = FCString::Atod(*Columns[4]);
+	}
+
+	return true;
+}
+
+FString FImportBenchmark::GetBaselineFile() {
+	return IPluginManager::Get().FindPlugin("JsonAsAsset")->GetBaseDir() / TEXT("Resources") / TEXT("Benchmarks") / TEXT("Baseline.csv");
+}
+
+TArray<FTransportBenchmarkResult> FImportBenchmark::RunTransport(const TArray<FString>& Fixtures, const int32 Repetitions) {
+	TArray<FTransportBenchmarkResult> Results;
+
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	for (const FString& Fixture : Fixtures) {
+		const FString ObjectPath = FString(FSyntheticExports::PackagePath) / Fixture + TEXT(".") + Fixture;
+
+		for (int32 Mode = 0; Mode < 4; Mode++) {
+			FTransportBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+			Result.Fixture = Fixture;
+			Result.bGzip = Mode >= 2;
+			Result.bKeepAlive = Mode >= 1;
+			Result.bBinary = Mode == 3;
+
+			double TotalMs = 0.0;
+			double TotalParseMs = 0.0;
+
+			for (int32 Repetition = 0; Repetition < Repetitions; Repetition++) {
+#if ENGINE_UE5
+				const TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+#else
+				const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+#endif
+				Request->SetURL(Settings->LocalFetchUrl + TEXT("/api/export?raw=true&path=") + ObjectPath);
+				Request->SetVerb(TEXT("GET"));
+
+				if (Result.bBinary) {
+					FRemoteUtilities::SetTransportHeaders(*Request);
+				} else {
+					Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+					Request->SetHeader(TEXT("Accept-Encoding"), Result.bGzip ? TEXT("gzip") : TEXT("identity"));
+					Request->SetHeader(TEXT("Connection"), Result.bKeepAlive ? TEXT("keep-alive") : TEXT("close"));
+				}
+
+				const double StartTime = FPlatformTime::Seconds();
+
+				/* Polls much faster than imports do, the default delay would hide the difference */
+				const FHttpResponsePtr Response = FRemoteUtilities::ExecuteRequestSync(Request, []() {}, 0.001f);
+				const TArray<uint8> Content = FRemoteUtilities::GetDecodedContent(Response);
+
+				const double ParseStartTime = FPlatformTime::Seconds();
+
+				/* Bypasses the export cache, which would turn every text parse after the first into a binary one */
+				const TSharedPtr<FJsonValue> Value = FJsonBinaryCache::IsEncoded(Content)
+					? FJsonBinaryCache::Decode(TArray<uint8>(Content))
+					: FMappedJsonReader::Read(FJsonSource::FromBuffer(TArray<uint8>(Content)), ObjectPath);
+
+				const double Milliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+				const double ParseMs = (FPlatformTime::Seconds() - ParseStartTime) * 1000.0;
+
+				if (!Response.IsValid() || !Value.IsValid()) {
+					UE_LOG(LogJson, Error, TEXT("Transport benchmark %s: request failed"), *Fixture);
+					break;
+				}
+
+				if (Repetition == 0) {
+					Result.FirstMs = Milliseconds;
+					Result.WireBytes = Response->GetContentLength();
+					Result.DecodedBytes = Content.Num();
+				}
+
+				TotalMs += Milliseconds;
+				TotalParseMs += ParseMs;
+
+				Result.AverageMs = TotalMs / (Repetition + 1);
+				Result.ParseMs = TotalParseMs / (Repetition + 1);
+			}
+
+			UE_LOG(LogJson, Display, TEXT("Transport %s (%s, %s, %s): %.1f KB on the wire, %.1f KB decoded, first %.2f ms, average %.2f ms, parse %.2f ms"), *Fixture,
+				Result.bBinary ? TEXT("binary") : TEXT("json"), Result.bGzip ? TEXT("gzip") : TEXT("identity"), Result.bKeepAlive ? TEXT("keep-alive") : TEXT("close"),
+				Result.WireBytes / 1024.0, Result.DecodedBytes / 1024.0, Result.FirstMs, Result.AverageMs, Result.ParseMs);
+		}
+	}
+
+	return Results;
+}
+
+bool FImportBenchmark::WriteTransportResults(const FString& File, const TArray<FTransportBenchmarkResult>& Results) {
+	FString Csv = TEXT("Fixture,Binary,Gzip,KeepAlive,WireBytes,DecodedBytes,FirstMs,AverageMs,ParseMs") LINE_TERMINATOR;
+
+	for (const FTransportBenchmarkResult& Result : Results) {
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%lld,%lld,%.3f,%.3f,%.3f") LINE_TERMINATOR, *Result.Fixture, Result.bBinary ? 1 : 0, Result.bGzip ? 1 : 0, Result.bKeepAlive ? 1 : 0,
+			Result.WireBytes, Result.DecodedBytes, Result.FirstMs, Result.AverageMs, Result.ParseMs);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *File);
+}
+
+/* Console Commands ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+static FAutoConsoleCommand GenerateSyntheticExportsCommand(
+	TEXT("JsonAsAsset.GenerateSyntheticExports"),
+	TEXT("Writes deterministic synthetic export JSON for benchmarking. Arguments: [Scale] [Directory]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		FSyntheticExportOptions Options;
+		if (Args.Num() > 0) Options.Scale = FCString::Atof(*Args[0]);
+
+		const FString Directory = Args.Num() > 1 ? Args[1] : FSyntheticExports::GetDefaultDirectory();
+		const TArray<FString> Files = FSyntheticExports::WriteCorpus(Directory, Options);
+
+		UE_LOG(LogJson, Display, TEXT("Wrote %d synthetic exports to \"%s\""), Files.Num(), *Directory);
+	})
+);
+
+static FAutoConsoleCommand BenchmarkCommand(
+	TEXT("JsonAsAsset.Benchmark"),
+	TEXT("Imports the synthetic exports and compares timings against the baseline. Arguments: [Threshold] [-WriteBaseline]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		float Threshold = FImportBenchmark::DefaultThreshold;
+		bool bWriteBaseline = false;
+
+		for (const FString& Arg : Args) {
+			if (Arg == TEXT("-WriteBaseline")) {
+				bWriteBaseline = true;
+			} else if (Arg.IsNumeric()) {
+				Threshold = FCString::Atof(*Arg);
+			}
+		}
+
+		const FString Directory = FSyntheticExports::GetDefaultDirectory();
+
+		if (!IFileManager::Get().DirectoryExists(*Directory)) {
+			FSyntheticExports::WriteCorpus(Directory, FSyntheticExportOptions());
+		}
+
+		const TArray<FImportBenchmarkResult> Results = FImportBenchmark::Run(Directory);
+
+		const FString ResultsFile = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset") / TEXT("Benchmarks") / FString::Printf(TEXT("Results_%s.csv"), *FDateTime::Now().ToString());
+		FImportBenchmark::WriteResults(ResultsFile, Results);
+
+		if (bWriteBaseline) {
+			FImportBenchmark::WriteResults(FImportBenchmark::GetBaselineFile(), Results);
+			UE_LOG(LogJson, Display, TEXT("Benchmark baseline written"));
+
+			return;
+		}
+
+		const int32 Regressions = FImportBenchmark::CompareToBaseline(FImportBenchmark::GetBaselineFile(), Results, Threshold);
+
+		if (Regressions > 0) {
+			UE_LOG(LogJson, Error, TEXT("Benchmark failed: %d regressions over %.0f%%, results in \"%s\""), Regressions, Threshold * 100.0f, *ResultsFile);
+		} else {
+			UE_LOG(LogJson, Display, TEXT("Benchmark passed, results in \"%s\""), *ResultsFile);
+		}
+	})
+);
+
+static FAutoConsoleCommand BenchmarkTransportCommand(
+	TEXT("JsonAsAsset.BenchmarkTransport"),
+	TEXT("Fetches a large material and level from Local Fetch as JSON and binary, with and without compression and keep-alive. Arguments: [Repetitions]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		const int32 Repetitions = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+
+		const FString Directory = FSyntheticExports::GetDefaultDirectory();
+
+		/* Corpora written before the level fixture existed */
+		if (!FPaths::FileExists(Directory / TEXT("L_Synthetic.json"))) {
+			FSyntheticExports::WriteCorpus(Directory, FSyntheticExportOptions());
+		}
+
+		/* Served by the stand-in unless it, or Local Fetch, is already running */
+		const bool bLaunched = !FLocalFetchStandIn::IsRunning() && FLocalFetchStandIn::Launch(FLocalFetchStandInOptions());
+
+		const TArray<FTransportBenchmarkResult> Results = FImportBenchmark::RunTransport({ TEXT("M_Synthetic"), TEXT("L_Synthetic") }, Repetitions);
+
+		if (bLaunched) {
+			FLocalFetchStandIn::Shutdown();
+		}
+
+		const FString ResultsFile = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset") / TEXT("Benchmarks") / FString::Printf(TEXT("Transport_%s.csv"), *FDateTime::Now().ToString());
+		FImportBenchmark::WriteTransportResults(ResultsFile, Results);
+
+		UE_LOG(LogJson, Display, TEXT("Transport benchmark results in \"%s\""), *ResultsFile);
+	})
+);
@@ -0,0 +1,459 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Benchmark/LocalFetchStandIn.h"
+
+#include "Async/Async.h"
+#include "Common/TcpSocketBuilder.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "JsonGlobals.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+#include "Utilities/ExportBatch.h"
+#include "Utilities/Benchmark/SyntheticExports.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+namespace {
+	TUniquePtr<FLocalFetchStandIn> StandInInstance;
+
+	/* Idle keep-alive connections are closed after this */
+	constexpr double IdleTimeoutSeconds = 5.0;
+
+	/* Bandwidth is throttled per chunk */
+	constexpr int32 SendChunkSize = 16 * 1024;
+
+	/* Smaller bodies aren't worth compressing */
+	constexpr int32 MinCompressSize = 1024;
+
+	void DestroySocket(FSocket* Socket) {
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+
+	void AppendString(TArray<uint8>& Bytes, const FString& String) {
+		const FTCHARToUTF8 Converted(*String);
+		Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	/* Value of a header line, empty when the request doesn't have it */
+	FString GetHeaderValue(const FString& Header, const TCHAR* Name) {
+		FString Value;
+
+		if (Header.Split(FString(TEXT("\r\n")) + Name + TEXT(":"), nullptr, &Value, ESearchCase::IgnoreCase)) {
+			Value.Split(TEXT("\r\n"), &Value, nullptr);
+		}
+
+		return Value.TrimStartAndEnd();
+	}
+
+	const TCHAR* GetStatusText(const int32 StatusCode) {
+		switch (StatusCode) {
+			case 200: return TEXT("OK");
+			case 404: return TEXT("Not Found");
+			default: return TEXT("Internal Server Error");
+		}
+	}
+}
+
+bool FLocalFetchStandIn::Launch(const FLocalFetchStandInOptions& Options) {
+	Shutdown();
+
+	StandInInstance = TUniquePtr<FLocalFetchStandIn>(new FLocalFetchStandIn(Options));
+
+	if (!StandInInstance->Listen()) {
+		StandInInstance.Reset();
+		return false;
+	}
+
+	StandInInstance->Thread = FRunnableThread::Create(StandInInstance.Get(), TEXT("JsonAsAssetLocalFetchStandIn"));
+
+	UE_LOG(LogJson, Display, TEXT("Local Fetch stand-in serving \"%s\" on port %d"), *StandInInstance->Options.Directory, Options.Port);
+
+	return true;
+}
+
+void FLocalFetchStandIn::Shutdown() {
+	StandInInstance.Reset();
+}
+
+bool FLocalFetchStandIn::IsRunning() {
+	return StandInInstance.IsValid();
+}
+
+FLocalFetchStandIn::FLocalFetchStandIn(const FLocalFetchStandInOptions& InOptions)
+	: Options(InOptions), Random(InOptions.Seed) {
+	if (Options.Directory.IsEmpty()) {
+		Options.Directory = FSyntheticExports::GetDefaultDirectory();
+	}
+}
+
+FLocalFetchStandIn::~FLocalFetchStandIn() {
+	bStopping = true;
+
+	if (Thread != nullptr) {
+		Thread->Kill(true);
+		delete Thread;
+	}
+
+	/* Connections notice bStopping on their next wait */
+	while (ActiveConnections.GetValue() > 0) {
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	if (ListenSocket != nullptr) {
+		DestroySocket(ListenSocket);
+	}
+
+	UE_LOG(LogJson, Display, TEXT("Local Fetch stand-in stopped: %d requests, %d injected errors, %.1f MB sent"),
+		RequestCount.GetValue(), ErrorCount.GetValue(), BytesSent.GetValue() / (1024.0 * 1024.0));
+}
+
+bool FLocalFetchStandIn::Listen() {
+	ListenSocket = FTcpSocketBuilder(TEXT("JsonAsAssetLocalFetchStandIn"))
+		.AsReusable()
+		.BoundToEndpoint(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), Options.Port))
+		.Listening(64)
+		.Build();
+
+	if (ListenSocket == nullptr) {
+		UE_LOG(LogJson, Error, TEXT("Local Fetch stand-in failed to listen on port %d, is Local Fetch already running?"), Options.Port);
+		return false;
+	}
+
+	return true;
+}
+
+uint32 FLocalFetchStandIn::Run() {
+	while (!bStopping) {
+		bool bPending = false;
+
+		if (!ListenSocket->WaitForPendingConnection(bPending, FTimespan::FromMilliseconds(100)) || !bPending) {
+			continue;
+		}
+
+		FSocket* Socket = ListenSocket->Accept(TEXT("JsonAsAssetLocalFetchStandInConnection"));
+		if (Socket == nullptr) continue;
+
+		/* One thread per connection, latency and throttling sleep on it */
+		ActiveConnections.Increment();
+
+		Async(EAsyncExecution::Thread, [this, Socket]() {
+			HandleConnection(Socket);
+
+			DestroySocket(Socket);
+			ActiveConnections.Decrement();
+		});
+	}
+
+	return 0;
+}
+
+void FLocalFetchStandIn::Stop() {
+	bStopping = true;
+}
+
+void FLocalFetchStandIn::HandleConnection(FSocket* Socket) {
+	Socket->SetNonBlocking(false);
+
+	TArray<uint8> Received;
+	double LastActivity = FPlatformTime::Seconds();
+
+	while (!bStopping) {
+		if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100))) {
+			if (FPlatformTime::Seconds() - LastActivity > IdleTimeoutSeconds) return;
+			continue;
+		}
+
+		uint8 Buffer[4096];
+		int32 BytesRead = 0;
+
+		/* Readable with nothing to read is a closed connection */
+		if (!Socket->Recv(Buffer, sizeof(Buffer), BytesRead) || BytesRead == 0) return;
+
+		Received.Append(Buffer, BytesRead);
+		LastActivity = FPlatformTime::Seconds();
+
+		while (true) {
+			int32 HeaderEnd = INDEX_NONE;
+
+			for (int32 Index = 0; Index + 3 < Received.Num(); Index++) {
+				if (Received[Index] == '\r' && Received[Index + 1] == '\n' && Received[Index + 2] == '\r' && Received[Index + 3] == '\n') {
+					HeaderEnd = Index;
+					break;
+				}
+			}
+
+			if (HeaderEnd == INDEX_NONE) break;
+
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Received.GetData()), HeaderEnd);
+			const FString Header = FString(Converted.Length(), Converted.Get());
+
+			/* Batch requests carry a body */
+			const int32 ContentLength = FMath::Max(0, FCString::Atoi(*GetHeaderValue(Header, TEXT("Content-Length"))));
+
+			if (Received.Num() < HeaderEnd + 4 + ContentLength) break;
+
+			const TArray<uint8> Body(Received.GetData() + HeaderEnd + 4, ContentLength);
+			Received.RemoveAt(0, HeaderEnd + 4 + ContentLength, false);
+
+			if (!HandleRequest(Socket, Header, Body)) return;
+
+			if (GetHeaderValue(Header, TEXT("Connection")) == TEXT("close")) return;
+		}
+	}
+}
+
+bool FLocalFetchStandIn::HandleRequest(FSocket* Socket, const FString& Header, const TArray<uint8>& RequestBody) {
+	RequestCount.Increment();
+
+	FString RequestLine = Header;
+	Header.Split(TEXT("\r\n"), &RequestLine, nullptr);
+
+	const bool bAcceptsGzip = GetHeaderValue(Header, TEXT("Accept-Encoding")).Contains(TEXT("gzip"));
+	/* Only the version this build decodes, like a Local Fetch build would */
+	const bool bAcceptsBinary = GetHeaderValue(Header, TEXT("Accept")).Contains(FJsonBinaryCache::GetWireContentType());
+
+	/* GET /api/export?raw=true&path=... HTTP/1.1 */
+	TArray<FString> Parts;
+	RequestLine.ParseIntoArray(Parts, TEXT(" "));
+	if (Parts.Num() < 2) return false;
+
+	FString Route = Parts[1];
+	FString Query;
+	Parts[1].Split(TEXT("?"), &Route, &Query);
+
+	TMap<FString, FString> Parameters;
+	TArray<FString> Pairs;
+	Query.ParseIntoArray(Pairs, TEXT("&"));
+
+	for (const FString& Pair : Pairs) {
+		FString Key, Value;
+		if (!Pair.Split(TEXT("="), &Key, &Value)) Key = Pair;
+
+		Parameters.Add(Key, FGenericPlatformHttp::UrlDecode(Value));
+	}
+
+	/* Injected latency and errors */
+	const int32 Latency = Options.LatencyMs + FMath::RoundToInt(NextRandom() * Options.LatencyJitterMs);
+	if (Latency > 0) {
+		FPlatformProcess::Sleep(Latency / 1000.0f);
+	}
+
+	TArray<uint8> Body;
+
+	if (Options.ErrorRate > 0.0f && NextRandom() < Options.ErrorRate) {
+		ErrorCount.Increment();
+		AppendString(Body, TEXT("{\"errored\":true,\"message\":\"Injected error\"}"));
+
+		return SendResponse(Socket, 500, TEXT("application/json; charset=utf-8"), Body);
+	}
+
+	if (Route == TEXT("/api/name")) {
+		AppendString(Body, Options.GameName);
+
+		return SendResponse(Socket, 200, TEXT("text/plain; charset=utf-8"), Body);
+	}
+
+	/* Frames for every requested path, see FExportBatch */
+	if (Route == FExportBatch::Route) {
+		for (const FString& Path : FExportBatch::ParseRequestBody(RequestBody)) {
+			TArray<uint8> Export;
+
+			if (!ReadExport(Path, Export, bAcceptsBinary)) {
+				AppendString(Export, TEXT("{\"errored\":true,\"message\":\"No fixture\"}"));
+			}
+
+			FExportBatch::AppendFrame(Body, Path, Export.GetData(), Export.Num());
+		}
+
+		return SendResponse(Socket, 200, FExportBatch::ContentType, Body, bAcceptsGzip);
+	}
+
+	if (Route == TEXT("/api/export")) {
+		const FString* Path = Parameters.Find(TEXT("path"));
+		const FString* Raw = Parameters.Find(TEXT("raw"));
+
+		const bool bRaw = Raw != nullptr && *Raw == TEXT("true");
+
+		/* Raw data, the same way Local Fetch sends texture and audio data */
+		if (Path != nullptr && !bRaw) {
+			const FString DataFile = FindFixture(*Path, TEXT(".bin"));
+
+			if (!DataFile.IsEmpty() && FFileHelper::LoadFileToArray(Body, *DataFile)) {
+				return SendResponse(Socket, 200, TEXT("application/octet-stream"), Body);
+			}
+		}
+
+		if (Path == nullptr || !ReadExport(*Path, Body, bAcceptsBinary)) {
+			AppendString(Body, TEXT("{\"errored\":true,\"message\":\"No fixture\"}"));
+
+			return SendResponse(Socket, 404, TEXT("application/json; charset=utf-8"), Body);
+		}
+
+		return SendResponse(Socket, 200, bAcceptsBinary ? FJsonBinaryCache::GetWireContentType() : TEXT("application/json; charset=utf-8"), Body, bAcceptsGzip);
+	}
+
+	AppendString(Body, TEXT("{\"errored\":true,\"message\":\"Unknown route\"}"));
+
+	return SendResponse(Socket, 404, TEXT("application/json; charset=utf-8"), Body);
+}
+
+bool FLocalFetchStandIn::SendResponse(FSocket* Socket, const int32 StatusCode, const FString& ContentType, const TArray<uint8>& Body, const bool bGzip) {
+	if (bGzip && Body.Num() >= MinCompressSize) {
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Body.Num());
+
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+
+		if (FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num())) {
+			TArray<uint8> Header;
+			AppendString(Header, FString::Printf(TEXT("HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Encoding: gzip\r\nContent-Length: %d\r\nConnection: keep-alive\r\n\r\n"),
+				StatusCode, GetStatusText(StatusCode), *ContentType, CompressedSize));
+
+			return SendThrottled(Socket, Header.GetData(), Header.Num()) && SendThrottled(Socket, Compressed.GetData(), CompressedSize);
+		}
+	}
+
+	TArray<uint8> Header;
+	AppendString(Header, FString::Printf(TEXT("HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %d\r\nConnection: keep-alive\r\n\r\n"),
+		StatusCode, GetStatusText(StatusCode), *ContentType, Body.Num()));
+
+	return SendThrottled(Socket, Header.GetData(), Header.Num()) && SendThrottled(Socket, Body.GetData(), Body.Num());
+}
+
+bool FLocalFetchStandIn::SendThrottled(FSocket* Socket, const uint8* Data, const int32 Num) {
+	const double StartTime = FPlatformTime::Seconds();
+	const double BytesPerSecond = Options.BandwidthKBps * 1024.0;
+
+	int32 Offset = 0;
+
+	while (Offset < Num) {
+		if (bStopping) return false;
+
+		int32 Sent = 0;
+		if (!Socket->Send(Data + Offset, FMath::Min(SendChunkSize, Num - Offset), Sent)) return false;
+
+		Offset += Sent;
+		BytesSent.Add(Sent);
+
+		/* Sleep until the average rate is back under the cap */
+		if (BytesPerSecond > 0.0) {
+			const double Ahead = Offset / BytesPerSecond - (FPlatformTime::Seconds() - StartTime);
+
+			if (Ahead > 0.0) {
+				FPlatformProcess::Sleep(static_cast<float>(Ahead));
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FLocalFetchStandIn::ReadExport(const FString& ObjectPath, TArray<uint8>& OutBody, const bool bBinary) {
+	const FString JsonFile = FindFixture(ObjectPath, TEXT(".json"));
+	if (JsonFile.IsEmpty()) return false;
+
+	/* Encoded once per fixture, Local Fetch would encode straight from its own export model */
+	if (bBinary) {
+		FScopeLock Lock(&EncodedExportsLock);
+
+		if (const TArray<uint8>* Encoded = EncodedExports.Find(JsonFile)) {
+			OutBody.Append(*Encoded);
+			return true;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		if (!FMappedJsonReader::ReadFile(JsonFile, Exports)) return false;
+
+		const TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+		Response->SetArrayField(TEXT("jsonOutput"), Exports);
+
+		TArray<uint8>& Encoded = EncodedExports.Add(JsonFile);
+		FJsonBinaryCache::Encode(MakeShared<FJsonValueObject>(Response), Encoded);
+
+		OutBody.Append(Encoded);
+		return true;
+	}
+
+	TArray<uint8> Json;
+	if (!FFileHelper::LoadFileToArray(Json, *JsonFile)) return false;
+
+	/* Byte order mark would end up in the middle of the response */
+	int32 JsonStart = 0;
+	if (Json.Num() >= 3 && Json[0] == 0xEF && Json[1] == 0xBB && Json[2] == 0xBF) {
+		JsonStart = 3;
+	}
+
+	/* Wrapped without parsing, fixtures can be large */
+	AppendString(OutBody, TEXT("{\"jsonOutput\":"));
+	OutBody.Append(Json.GetData() + JsonStart, Json.Num() - JsonStart);
+	AppendString(OutBody, TEXT("}"));
+
+	return true;
+}
+
+FString FLocalFetchStandIn::FindFixture(const FString& ObjectPath, const FString& Extension) const {
+	FString PackagePath = ObjectPath;
+	ObjectPath.Split(TEXT("."), &PackagePath, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+
+	PackagePath.RemoveFromStart(TEXT("/"));
+
+	const FString Candidates[] = {
+		Options.Directory / PackagePath + Extension,
+		Options.Directory / FPaths::GetCleanFilename(PackagePath) + Extension
+	};
+
+	for (const FString& Candidate : Candidates) {
+		/* Never serve anything outside the fixture directory */
+		if (Candidate.Contains(TEXT(".."))) continue;
+
+		if (FPaths::FileExists(Candidate)) {
+			return Candidate;
+		}
+	}
+
+	return FString();
+}
+
+float FLocalFetchStandIn::NextRandom() {
+	FScopeLock Lock(&RandomLock);
+
+	return Random.GetFraction();
+}
+
+/* Console Commands ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+static FAutoConsoleCommand StartStandInCommand(
+	TEXT("JsonAsAsset.LocalFetchStandIn.Start"),
+	TEXT("Serves export JSON like Local Fetch. Arguments: [Dir=] [Port=1500] [Latency=ms] [Jitter=ms] [Bandwidth=KB/s] [ErrorRate=0-1] [Seed=]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		FLocalFetchStandInOptions Options;
+
+		for (const FString& Arg : Args) {
+			FString Key, Value;
+			if (!Arg.Split(TEXT("="), &Key, &Value)) continue;
+
+			if (Key == TEXT("Dir")) Options.Directory = Value;
+			else if (Key == TEXT("Port")) Options.Port = FCString::Atoi(*Value);
+			else if (Key == TEXT("Latency")) Options.LatencyMs = FCString::Atoi(*Value);
+			else if (Key == TEXT("Jitter")) Options.LatencyJitterMs = FCString::Atoi(*Value);
+			else if (Key == TEXT("Bandwidth")) Options.BandwidthKBps = FCString::Atoi(*Value);
+			else if (Key == TEXT("ErrorRate")) Options.ErrorRate = FCString::Atof(*Value);
+			else if (Key == TEXT("Seed")) Options.Seed = FCString::Atoi(*Value);
+		}
+
+		FLocalFetchStandIn::Launch(Options);
+	})
+);
+
+static FAutoConsoleCommand StopStandInCommand(
+	TEXT("JsonAsAsset.LocalFetchStandIn.Stop"),
+	TEXT("Stops the Local Fetch stand-in"),
+	FConsoleCommandDelegate::CreateStatic(&FLocalFetchStandIn::Shutdown)
+);
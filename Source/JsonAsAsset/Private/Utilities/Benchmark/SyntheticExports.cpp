@@ -0,0 +1,505 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Benchmark/SyntheticExports.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+const TCHAR* FSyntheticExports::PackagePath = TEXT("/Game/JsonAsAssetBenchmark");
+const TCHAR* FSyntheticExports::GameName = TEXT("JsonAsAssetBenchmark");
+
+namespace {
+	/* String literals are wrapped in FString below, a bare TCHAR* would pick WriteValue's bool overload */
+	typedef TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>> FWriter;
+
+	/* Reference to another export in the same file, as FModel writes them */
+	void WriteReference(FWriter& Writer, const FString& Identifier, const FString& Class, const FString& Outer, const FString& Name, const int32 Index) {
+		Writer.WriteObjectStart(Identifier);
+		Writer.WriteValue(TEXT("ObjectName"), FString::Printf(TEXT("%s'%s:%s'"), *Class, *Outer, *Name));
+		Writer.WriteValue(TEXT("ObjectPath"), FString::Printf(TEXT("%s/%s.%d"), FSyntheticExports::PackagePath, *Outer, Index));
+		Writer.WriteObjectEnd();
+	}
+
+	void WriteVector(FWriter& Writer, const FString& Identifier, const FVector& Vector) {
+		Writer.WriteObjectStart(Identifier);
+		Writer.WriteValue(TEXT("X"), Vector.X);
+		Writer.WriteValue(TEXT("Y"), Vector.Y);
+		Writer.WriteValue(TEXT("Z"), Vector.Z);
+		Writer.WriteObjectEnd();
+	}
+
+	int32 Scaled(const int32 Count, const float Scale) {
+		return FMath::Max(1, FMath::RoundToInt(Count * Scale));
+	}
+}
+
+FString FSyntheticExports::GetDefaultDirectory() {
+	return FPaths::ProjectSavedDir() / TEXT("JsonAsAsset") / TEXT("SyntheticExports");
+}
+
+TArray<FString> FSyntheticExports::WriteCorpus(const FString& Directory, const FSyntheticExportOptions& Options) {
+	TArray<FString> Files;
+
+	auto Write = [&Files, &Directory](const FString& Name, const FString& Json) {
+		const FString File = Directory / Name + TEXT(".json");
+
+		if (FFileHelper::SaveStringToFile(Json, *File, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)) {
+			Files.Add(File);
+		} else {
+			UE_LOG(LogJson, Error, TEXT("Failed to write \"%s\""), *File);
+		}
+	};
+
+	const float Scale = Options.Scale;
+
+	Write(TEXT("DT_Synthetic"), DataTable(TEXT("DT_Synthetic"), Scaled(Options.DataTableRows, Scale), Options.Seed));
+	Write(TEXT("M_Synthetic"), Material(TEXT("M_Synthetic"), Scaled(Options.MaterialExpressions, Scale), Options.Seed));
+	Write(TEXT("M_Synthetic_Textured"), TexturedMaterial(TEXT("M_Synthetic_Textured"), { TEXT("T_Synthetic_DXT1"), TEXT("T_Synthetic_DXT5"), TEXT("T_Synthetic_BC7"), TEXT("T_Synthetic_BC5") }));
+	Write(TEXT("SK_Synthetic_Skeleton"), Skeleton(TEXT("SK_Synthetic_Skeleton"), Scaled(Options.SkeletonBones, Scale), Options.Seed));
+	Write(TEXT("A_Synthetic"), AnimSequence(TEXT("A_Synthetic"), Scaled(Options.AnimationCurves, Scale), Scaled(Options.AnimationKeys, Scale), Options.Seed));
+	Write(TEXT("L_Synthetic"), Level(TEXT("L_Synthetic"), Scaled(Options.LevelActors, Scale), Options.Seed));
+
+	/* Block compressed textures need a multiple of 4 */
+	const int32 TextureSize = FMath::Max(4, Scaled(Options.TextureSize, Scale) & ~3);
+
+	const TCHAR* PixelFormats[] = { TEXT("PF_DXT1"), TEXT("PF_DXT5"), TEXT("PF_BC7"), TEXT("PF_G8"), TEXT("PF_BC4"), TEXT("PF_BC5"), TEXT("PF_BC6H"),
+		TEXT("PF_ETC1"), TEXT("PF_ETC2_RGB"), TEXT("PF_ETC2_RGBA"), TEXT("PF_ETC2_R11_EAC"), TEXT("PF_ETC2_RG11_EAC") };
+
+	for (const TCHAR* PixelFormat : PixelFormats) {
+		const FString Name = FString::Printf(TEXT("T_Synthetic_%s"), PixelFormat + 3);
+
+		TArray<uint8> Payload;
+		Write(Name, Texture2D(Name, PixelFormat, TextureSize, Options.Seed, Payload));
+
+		FFileHelper::SaveArrayToFile(Payload, *(Directory / Name + TEXT(".bin")));
+	}
+
+	/* Full mip chain, only imported as such with importing all mips enabled */
+	{
+		const FString Name = TEXT("T_Synthetic_DXT5_Mips");
+
+		TArray<uint8> Payload;
+		Write(Name, Texture2D(Name, TEXT("PF_DXT5"), TextureSize, Options.Seed, Payload, FMath::FloorLog2(TextureSize) + 1));
+
+		FFileHelper::SaveArrayToFile(Payload, *(Directory / Name + TEXT(".bin")));
+	}
+
+	return Files;
+}
+
+FString FSyntheticExports::DataTable(const FString& Name, const int32 Rows, const int32 Seed) {
+	FRandomStream Random(Seed);
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	Writer->WriteArrayStart();
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("DataTable")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'DataTable'")));
+
+	/* Engine row struct, so the table imports without a project specific struct */
+	Writer->WriteObjectStart(TEXT("Properties"));
+	Writer->WriteObjectStart(TEXT("RowStruct"));
+	Writer->WriteValue(TEXT("ObjectName"), FString(TEXT("ScriptStruct'GameplayTagTableRow'")));
+	Writer->WriteValue(TEXT("ObjectPath"), FString(TEXT("/Script/GameplayTags")));
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectStart(TEXT("Rows"));
+
+	for (int32 Row = 0; Row < Rows; Row++) {
+		Writer->WriteObjectStart(FString::Printf(TEXT("Row_%06d"), Row));
+		Writer->WriteValue(TEXT("Tag"), FString::Printf(TEXT("Synthetic.Group%d.Tag%d"), Random.RandRange(0, 63), Row));
+		Writer->WriteValue(TEXT("DevComment"), FString::Printf(TEXT("Generated row %d, weight %.4f"), Row, Random.FRand()));
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::Material(const FString& Name, const int32 Expressions, const int32 Seed) {
+	FRandomStream Random(Seed);
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	auto ExpressionName = [](const int32 Index) {
+		return Index == 0 ? FString(TEXT("MaterialExpressionConstant_0")) : FString::Printf(TEXT("MaterialExpressionAdd_%d"), Index);
+	};
+
+	auto ExpressionClass = [](const int32 Index) {
+		return Index == 0 ? FString(TEXT("MaterialExpressionConstant")) : FString(TEXT("MaterialExpressionAdd"));
+	};
+
+	Writer->WriteArrayStart();
+
+	/* The material comes first, the expressions after it are indices 1..N */
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("Material")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'Material'")));
+	Writer->WriteObjectStart(TEXT("Properties"));
+	WriteReference(*Writer, TEXT("BaseColor"), ExpressionClass(Expressions - 1), Name, ExpressionName(Expressions - 1), Expressions);
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+
+	/* A chain of adds on a constant, each one feeding the next */
+	for (int32 Index = 0; Index < Expressions; Index++) {
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Type"), ExpressionClass(Index));
+		Writer->WriteValue(TEXT("Name"), ExpressionName(Index));
+		Writer->WriteValue(TEXT("Outer"), Name);
+		Writer->WriteValue(TEXT("Class"), FString::Printf(TEXT("UScriptClass'%s'"), *ExpressionClass(Index)));
+
+		Writer->WriteObjectStart(TEXT("Properties"));
+
+		if (Index == 0) {
+			Writer->WriteValue(TEXT("R"), Random.FRand());
+		} else {
+			Writer->WriteObjectStart(TEXT("A"));
+			WriteReference(*Writer, TEXT("Expression"), ExpressionClass(Index - 1), Name, ExpressionName(Index - 1), Index);
+			Writer->WriteObjectEnd();
+
+			Writer->WriteValue(TEXT("ConstB"), Random.FRand());
+		}
+
+		Writer->WriteValue(TEXT("MaterialExpressionEditorX"), -200 * (Expressions - Index));
+		Writer->WriteValue(TEXT("MaterialExpressionEditorY"), (Index % 8) * 96);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::TexturedMaterial(const FString& Name, const TArray<FString>& Textures) {
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	auto ExpressionName = [](const int32 Index) {
+		return FString::Printf(TEXT("MaterialExpressionTextureSample_%d"), Index);
+	};
+
+	/* Texture fixtures are imported to PackagePath/Name, "/Game/Path" is exported as "GameName/Content/Path" */
+	const FString ExportedPackagePath = FString(GameName) / TEXT("Content") + FString(PackagePath).RightChop(FCString::Strlen(TEXT("/Game")));
+
+	Writer->WriteArrayStart();
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("Material")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'Material'")));
+	Writer->WriteObjectStart(TEXT("Properties"));
+	WriteReference(*Writer, TEXT("BaseColor"), TEXT("MaterialExpressionTextureSample"), Name, ExpressionName(0), 1);
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+
+	for (int32 Index = 0; Index < Textures.Num(); Index++) {
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Type"), FString(TEXT("MaterialExpressionTextureSample")));
+		Writer->WriteValue(TEXT("Name"), ExpressionName(Index));
+		Writer->WriteValue(TEXT("Outer"), Name);
+		Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'MaterialExpressionTextureSample'")));
+
+		Writer->WriteObjectStart(TEXT("Properties"));
+		Writer->WriteObjectStart(TEXT("Texture"));
+		Writer->WriteValue(TEXT("ObjectName"), FString::Printf(TEXT("Texture2D'%s'"), *Textures[Index]));
+		Writer->WriteValue(TEXT("ObjectPath"), FString::Printf(TEXT("%s/%s.0"), *ExportedPackagePath, *Textures[Index]));
+		Writer->WriteObjectEnd();
+
+		Writer->WriteValue(TEXT("MaterialExpressionEditorX"), -400);
+		Writer->WriteValue(TEXT("MaterialExpressionEditorY"), Index * 256);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::Skeleton(const FString& Name, const int32 Bones, const int32 Seed) {
+	FRandomStream Random(Seed);
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	Writer->WriteArrayStart();
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("Skeleton")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'Skeleton'")));
+
+	Writer->WriteObjectStart(TEXT("Properties"));
+	Writer->WriteObjectStart(TEXT("ReferenceSkeleton"));
+
+	/* Each bone parented to one of the bones before it, so the hierarchy is valid */
+	Writer->WriteArrayStart(TEXT("FinalRefBoneInfo"));
+	for (int32 Bone = 0; Bone < Bones; Bone++) {
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Name"), FString::Printf(TEXT("bone_%04d"), Bone));
+		Writer->WriteValue(TEXT("ParentIndex"), Bone == 0 ? INDEX_NONE : Random.RandRange(FMath::Max(0, Bone - 4), Bone - 1));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("FinalRefBonePose"));
+	for (int32 Bone = 0; Bone < Bones; Bone++) {
+		const FQuat Rotation = FRotator(Random.FRandRange(-180, 180), Random.FRandRange(-180, 180), Random.FRandRange(-180, 180)).Quaternion();
+
+		Writer->WriteObjectStart();
+		Writer->WriteObjectStart(TEXT("Rotation"));
+		Writer->WriteValue(TEXT("X"), Rotation.X);
+		Writer->WriteValue(TEXT("Y"), Rotation.Y);
+		Writer->WriteValue(TEXT("Z"), Rotation.Z);
+		Writer->WriteValue(TEXT("W"), Rotation.W);
+		Writer->WriteObjectEnd();
+		WriteVector(*Writer, TEXT("Translation"), FVector(Random.FRandRange(-20, 20), Random.FRandRange(-20, 20), Random.FRandRange(-20, 20)));
+		WriteVector(*Writer, TEXT("Scale3D"), FVector(1.0f));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectStart(TEXT("FinalNameToIndexMap"));
+	for (int32 Bone = 0; Bone < Bones; Bone++) {
+		Writer->WriteValue(FString::Printf(TEXT("bone_%04d"), Bone), Bone);
+	}
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::Level(const FString& Name, const int32 Actors, const int32 Seed) {
+	FRandomStream Random(Seed);
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	Writer->WriteArrayStart();
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("World")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteObjectStart(TEXT("Properties"));
+	WriteReference(*Writer, TEXT("PersistentLevel"), TEXT("Level"), Name, TEXT("PersistentLevel"), 1);
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("Level")));
+	Writer->WriteValue(TEXT("Name"), FString(TEXT("PersistentLevel")));
+	Writer->WriteValue(TEXT("Outer"), Name);
+	Writer->WriteArrayStart(TEXT("Actors"));
+	for (int32 Actor = 0; Actor < Actors; Actor++) {
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("ObjectName"), FString::Printf(TEXT("StaticMeshActor'%s:PersistentLevel.StaticMeshActor_%d'"), *Name, Actor));
+		Writer->WriteValue(TEXT("ObjectPath"), FString::Printf(TEXT("%s/%s.%d"), FSyntheticExports::PackagePath, *Name, 2 + Actor * 2));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+
+	/* A handful of meshes repeated over the level, like props in a real map */
+	for (int32 Actor = 0; Actor < Actors; Actor++) {
+		const FString ActorName = FString::Printf(TEXT("StaticMeshActor_%d"), Actor);
+		const int32 Mesh = Random.RandRange(0, 31);
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Type"), FString(TEXT("StaticMeshActor")));
+		Writer->WriteValue(TEXT("Name"), ActorName);
+		Writer->WriteValue(TEXT("Outer"), FString(TEXT("PersistentLevel")));
+		Writer->WriteObjectStart(TEXT("Properties"));
+		WriteReference(*Writer, TEXT("StaticMeshComponent"), TEXT("StaticMeshComponent"), Name, ActorName + TEXT(".StaticMeshComponent0"), 3 + Actor * 2);
+		WriteReference(*Writer, TEXT("RootComponent"), TEXT("StaticMeshComponent"), Name, ActorName + TEXT(".StaticMeshComponent0"), 3 + Actor * 2);
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Type"), FString(TEXT("StaticMeshComponent")));
+		Writer->WriteValue(TEXT("Name"), FString(TEXT("StaticMeshComponent0")));
+		Writer->WriteValue(TEXT("Outer"), ActorName);
+		Writer->WriteObjectStart(TEXT("Properties"));
+		Writer->WriteObjectStart(TEXT("StaticMesh"));
+		Writer->WriteValue(TEXT("ObjectName"), FString::Printf(TEXT("StaticMesh'SM_Prop_%02d'"), Mesh));
+		Writer->WriteValue(TEXT("ObjectPath"), FString::Printf(TEXT("/Game/Environment/Props/SM_Prop_%02d.0"), Mesh));
+		Writer->WriteObjectEnd();
+		WriteVector(*Writer, TEXT("RelativeLocation"), FVector(Random.FRandRange(-50000, 50000), Random.FRandRange(-50000, 50000), Random.FRandRange(0, 2000)));
+		Writer->WriteObjectStart(TEXT("RelativeRotation"));
+		Writer->WriteValue(TEXT("Pitch"), 0.0f);
+		Writer->WriteValue(TEXT("Yaw"), Random.FRandRange(-180, 180));
+		Writer->WriteValue(TEXT("Roll"), 0.0f);
+		Writer->WriteObjectEnd();
+		WriteVector(*Writer, TEXT("RelativeScale3D"), FVector(Random.FRandRange(0.5f, 2.0f)));
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::AnimSequence(const FString& Name, const int32 Curves, const int32 Keys, const int32 Seed) {
+	FRandomStream Random(Seed);
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	constexpr float FrameTime = 1.0f / 30.0f;
+
+	Writer->WriteArrayStart();
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("AnimSequence")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'AnimSequence'")));
+
+	Writer->WriteObjectStart(TEXT("Properties"));
+	Writer->WriteValue(TEXT("SequenceLength"), Keys * FrameTime);
+	Writer->WriteObjectStart(TEXT("RawCurveData"));
+	Writer->WriteArrayStart(TEXT("FloatCurves"));
+
+	for (int32 Curve = 0; Curve < Curves; Curve++) {
+		Writer->WriteObjectStart();
+		Writer->WriteObjectStart(TEXT("Name"));
+		Writer->WriteValue(TEXT("DisplayName"), FString::Printf(TEXT("Curve_%03d"), Curve));
+		Writer->WriteObjectEnd();
+		Writer->WriteValue(TEXT("CurveTypeFlags"), 4);
+
+		Writer->WriteObjectStart(TEXT("FloatCurve"));
+		Writer->WriteArrayStart(TEXT("Keys"));
+
+		for (int32 Key = 0; Key < Keys; Key++) {
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("InterpMode"), FString(TEXT("RCIM_Cubic")));
+			Writer->WriteValue(TEXT("TangentMode"), FString(TEXT("RCTM_Auto")));
+			Writer->WriteValue(TEXT("TangentWeightMode"), FString(TEXT("RCTWM_WeightedNone")));
+			Writer->WriteValue(TEXT("Time"), Key * FrameTime);
+			Writer->WriteValue(TEXT("Value"), Random.FRand());
+			Writer->WriteValue(TEXT("ArriveTangent"), 0.0f);
+			Writer->WriteValue(TEXT("ArriveTangentWeight"), 0.0f);
+			Writer->WriteValue(TEXT("LeaveTangent"), 0.0f);
+			Writer->WriteValue(TEXT("LeaveTangentWeight"), 0.0f);
+			Writer->WriteObjectEnd();
+		}
+
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FSyntheticExports::Texture2D(const FString& Name, const FString& PixelFormat, const int32 Size, const int32 Seed, TArray<uint8>& OutPayload, const int32 NumMips) {
+	FRandomStream Random(Seed);
+
+	/* G8 isn't block compressed, each pixel is a block of its own */
+	const bool bUncompressed = PixelFormat == TEXT("PF_G8");
+
+	/* 64 bit blocks, the others are 128 bit */
+	const bool bHalfBlocks = PixelFormat == TEXT("PF_DXT1") || PixelFormat == TEXT("PF_BC4") || PixelFormat == TEXT("PF_ETC1")
+		|| PixelFormat == TEXT("PF_ETC2_RGB") || PixelFormat == TEXT("PF_ETC2_R11_EAC");
+
+	const int32 BlockBytes = bUncompressed ? 1 : bHalfBlocks ? 8 : 16;
+
+	int32 Blocks = 0;
+
+	for (int32 Mip = 0; Mip < NumMips; Mip++) {
+		const int32 MipSize = FMath::Max(Size >> Mip, 1);
+		Blocks += bUncompressed ? MipSize * MipSize : FMath::Square(FMath::DivideAndRoundUp(MipSize, 4));
+	}
+
+	OutPayload.SetNumUninitialized(Blocks * BlockBytes);
+
+	for (int32 Block = 0; Block < Blocks; Block++) {
+		uint8* BlockData = OutPayload.GetData() + Block * BlockBytes;
+
+		for (int32 Byte = 0; Byte < BlockBytes; Byte++) {
+			BlockData[Byte] = static_cast<uint8>(Random.RandRange(0, 255));
+		}
+
+		/* Random BC7 blocks would mostly use the reserved mode, pick mode 6 */
+		if (PixelFormat == TEXT("PF_BC7")) {
+			BlockData[0] = 0x40 | (BlockData[0] & 0x80);
+		}
+
+		/* Same for BC6H, pick mode 1 */
+		if (PixelFormat == TEXT("PF_BC6H")) {
+			BlockData[0] &= ~0x03;
+		}
+	}
+
+	FString Json;
+	const TSharedRef<FWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	Writer->WriteArrayStart();
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Type"), FString(TEXT("Texture2D")));
+	Writer->WriteValue(TEXT("Name"), Name);
+	Writer->WriteValue(TEXT("Class"), FString(TEXT("UScriptClass'Texture2D'")));
+	Writer->WriteValue(TEXT("SizeX"), Size);
+	Writer->WriteValue(TEXT("SizeY"), Size);
+	Writer->WriteValue(TEXT("PackedData"), 1);
+	Writer->WriteValue(TEXT("PixelFormat"), PixelFormat);
+
+	Writer->WriteArrayStart(TEXT("Mips"));
+
+	for (int32 Mip = 0; Mip < NumMips; Mip++) {
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("SizeX"), FMath::Max(Size >> Mip, 1));
+		Writer->WriteValue(TEXT("SizeY"), FMath::Max(Size >> Mip, 1));
+		Writer->WriteValue(TEXT("SizeZ"), 1);
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectStart(TEXT("Properties"));
+	if (PixelFormat == TEXT("PF_BC5") || PixelFormat == TEXT("PF_ETC2_RG11_EAC")) {
+		Writer->WriteValue(TEXT("SRGB"), false);
+		Writer->WriteValue(TEXT("CompressionSettings"), FString(TEXT("TextureCompressionSettings::TC_Normalmap")));
+	} else if (PixelFormat == TEXT("PF_BC6H")) {
+		Writer->WriteValue(TEXT("SRGB"), false);
+		Writer->WriteValue(TEXT("CompressionSettings"), FString(TEXT("TextureCompressionSettings::TC_HDR")));
+	} else {
+		Writer->WriteValue(TEXT("SRGB"), true);
+		Writer->WriteValue(TEXT("CompressionSettings"), FString(TEXT("TextureCompressionSettings::TC_Default")));
+	}
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return Json;
+}
@@ -0,0 +1,186 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ExportBatch.h"
+
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Compatibility.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/RemoteUtilities.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+
+const TCHAR* FExportBatch::Route = TEXT("/api/exports");
+const TCHAR* FExportBatch::ContentType = TEXT("application/x-jsonasasset-frames");
+
+namespace {
+#if ENGINE_UE5
+	typedef TSharedRef<IHttpRequest> FBatchRequestRef;
+#else
+	typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FBatchRequestRef;
+#endif
+
+	/* Local Fetch URL that answered without the endpoint */
+	FString UnsupportedUrl;
+
+	void AppendUtf8(TArray<uint8>& Bytes, const FString& String) {
+		const FTCHARToUTF8 Converted(*String);
+		Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	/* Reads up to the next newline, false if there is none */
+	bool ReadLine(const TArray<uint8>& Content, int32& Offset, FString& OutLine) {
+		const int32 Start = Offset;
+
+		while (Offset < Content.Num() && Content[Offset] != '\n') {
+			Offset++;
+		}
+
+		if (Offset >= Content.Num()) return false;
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData() + Start), Offset - Start);
+		OutLine = FString(Converted.Length(), Converted.Get());
+
+		/* Skip the newline */
+		Offset++;
+
+		return true;
+	}
+}
+
+TArray<uint8> FExportBatch::MakeRequestBody(const TArray<FString>& Paths) {
+	TArray<uint8> Body;
+	AppendUtf8(Body, FString::Join(Paths, TEXT("\n")));
+
+	return Body;
+}
+
+TArray<FString> FExportBatch::ParseRequestBody(const TArray<uint8>& Body) {
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+
+	TArray<FString> Paths;
+	FString(Converted.Length(), Converted.Get()).ParseIntoArrayLines(Paths);
+
+	return Paths;
+}
+
+void FExportBatch::AppendFrame(TArray<uint8>& Out, const FString& Path, const uint8* Data, const int32 Num) {
+	AppendUtf8(Out, FString::Printf(TEXT("%s\n%d\n"), *Path, Num));
+	Out.Append(Data, Num);
+}
+
+bool FExportBatch::ReadFrames(const TArray<uint8>& Content, const TFunctionRef<void(const FString& Path, TArray<uint8>&& Json)> OnFrame) {
+	int32 Offset = 0;
+
+	while (Offset < Content.Num()) {
+		FString Path, Count;
+
+		if (!ReadLine(Content, Offset, Path) || !ReadLine(Content, Offset, Count)) return false;
+
+		const int32 Num = FCString::Atoi(*Count);
+		if (Num < 0 || Num > Content.Num() - Offset) return false;
+
+		OnFrame(Path, TArray<uint8>(Content.GetData() + Offset, Num));
+		Offset += Num;
+	}
+
+	return true;
+}
+
+bool FExportBatch::RequestExports(const TArray<FString>& Paths, TMap<FString, TSharedPtr<FJsonObject>>& OutResponses) {
+	if (Paths.Num() == 0 || !IsSupported()) return false;
+
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	TArray<FBatchRequestRef> Requests;
+
+	for (int32 Start = 0; Start < Paths.Num(); Start += MaxPathsPerRequest) {
+		const TArray<FString> Chunk(Paths.GetData() + Start, FMath::Min(MaxPathsPerRequest, Paths.Num() - Start));
+
+		FBatchRequestRef Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(Settings->LocalFetchUrl + Route);
+		Request->SetVerb(TEXT("POST"));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("text/plain; charset=utf-8"));
+		Request->SetContent(MakeRequestBody(Chunk));
+		FRemoteUtilities::SetTransportHeaders(*Request);
+
+		Requests.Add(Request);
+	}
+
+	/* A few requests in flight at once, same loop as FRemoteUtilities::ExecuteRequestSync */
+	TArray<FHttpResponsePtr> Responses; {
+		JSONASASSET_PHASE_SCOPE(Http);
+
+		TArray<FBatchRequestRef> Running;
+		int32 NextRequest = 0;
+
+		double LastTime = FPlatformTime::Seconds();
+
+		while (NextRequest < Requests.Num() || Running.Num() > 0) {
+			while (Running.Num() < MaxConcurrentRequests && NextRequest < Requests.Num()) {
+				const FBatchRequestRef& Request = Requests[NextRequest++];
+
+				if (Request->ProcessRequest()) {
+					Running.Add(Request);
+				}
+			}
+
+			const double AppTime = FPlatformTime::Seconds();
+			FHttpModule::Get().GetHttpManager().Tick(AppTime - LastTime);
+			LastTime = AppTime;
+
+			for (int32 Index = Running.Num() - 1; Index >= 0; Index--) {
+				if (Running[Index]->GetStatus() == EHttpRequestStatus::Processing) continue;
+
+				Responses.Add(Running[Index]->GetResponse());
+				Running.RemoveAtSwap(Index);
+			}
+
+			FPlatformProcess::Sleep(0.01f);
+		}
+	}
+
+	bool bSupported = true;
+
+	for (const FHttpResponsePtr& Response : Responses) {
+		if (!Response.IsValid()) continue;
+
+		if (!Response->GetContentType().StartsWith(ContentType)) {
+			if (Response->GetResponseCode() == 404) {
+				SetUnsupported();
+				bSupported = false;
+			}
+
+			continue;
+		}
+
+		ReadFrames(FRemoteUtilities::GetDecodedContent(Response), [&OutResponses](const FString& Path, TArray<uint8>&& Json) {
+			JSONASASSET_PHASE_SCOPE(Parse);
+
+			const bool bEncoded = FJsonBinaryCache::IsEncoded(Json);
+			const TSharedPtr<FJsonValue> Value = FJsonBinaryCache::ReadBuffer(MoveTemp(Json), Path);
+
+			if (Value.IsValid() && Value->Type == EJson::Object) {
+				OutResponses.Add(Path, Value->AsObject());
+			}
+			/* Left out, its own request later asks for JSON */
+			else if (!Value.IsValid() && bEncoded) {
+				FRemoteUtilities::DisableBinaryTransport();
+			}
+		});
+	}
+
+	return bSupported;
+}
+
+bool FExportBatch::IsSupported() {
+	return UnsupportedUrl != GetDefault<UJsonAsAssetSettings>()->LocalFetchUrl;
+}
+
+void FExportBatch::SetUnsupported() {
+	UnsupportedUrl = GetDefault<UJsonAsAssetSettings>()->LocalFetchUrl;
+
+	UE_LOG(LogJson, Log, TEXT("Local Fetch has no batch endpoint, requesting exports one at a time"));
+}
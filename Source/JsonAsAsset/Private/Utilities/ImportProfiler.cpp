@@ -0,0 +1,207 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportProfiler.h"
+
+#include "HAL/FileManager.h"
+#include "Logging/MessageLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+
+DEFINE_STAT(STAT_JsonAsAsset_Parse);
+DEFINE_STAT(STAT_JsonAsAsset_CreatePackage);
+DEFINE_STAT(STAT_JsonAsAsset_FindImporter);
+DEFINE_STAT(STAT_JsonAsAsset_DeserializeProperties);
+DEFINE_STAT(STAT_JsonAsAsset_DeserializeProperty);
+DEFINE_STAT(STAT_JsonAsAsset_ResolveReference);
+DEFINE_STAT(STAT_JsonAsAsset_Http);
+DEFINE_STAT(STAT_JsonAsAsset_TextureDecode);
+DEFINE_STAT(STAT_JsonAsAsset_MaterialCompile);
+DEFINE_STAT(STAT_JsonAsAsset_SavePackage);
+
+namespace {
+	constexpr int32 PhaseCount = static_cast<int32>(EImportPhase::Count);
+
+	const TCHAR* PhaseNames[PhaseCount] = {
+		TEXT("Parse"),
+		TEXT("Create Package"),
+		TEXT("Find Importer"),
+		TEXT("Deserialize Properties"),
+		TEXT("Deserialize Property"),
+		TEXT("Resolve Reference"),
+		TEXT("HTTP"),
+		TEXT("Texture Decode"),
+		TEXT("Material Compile"),
+		TEXT("Save Package"),
+	};
+
+	struct FPhaseRecord {
+		uint64 Cycles = 0;
+		int32 Calls = 0;
+
+		/* Recursive phases (properties inside properties) are only timed at the outermost call */
+		int32 Depth = 0;
+	};
+
+	struct FAssetRecord {
+		FString Name;
+		FString Type;
+		int64 Bytes = 0;
+
+		uint64 StartCycles = 0;
+		uint64 Cycles = 0;
+
+		FPhaseRecord Phases[PhaseCount];
+	};
+
+	/* Only touched on the game thread */
+	TArray<FAssetRecord> Records;
+
+	/* Assets being imported, innermost last */
+	TArray<int32> ActiveAssets;
+
+	/* Phases that ran before any asset started, like parsing the file, go to the next asset */
+	FAssetRecord Pending;
+
+	int32 BatchDepth = 0;
+	bool bRecording = false;
+	uint64 BatchStartCycles = 0;
+
+	FAssetRecord* GetCurrentRecord() {
+		return ActiveAssets.Num() > 0 ? &Records[ActiveAssets.Last()] : &Pending;
+	}
+
+	double ToMilliseconds(const uint64 Cycles) {
+		return FPlatformTime::ToMilliseconds64(Cycles);
+	}
+
+	void WriteReport() {
+		if (Records.Num() == 0) return;
+
+		/* CSV, one row per asset */
+		FString Csv = TEXT("Asset,Type,Bytes,Total (ms)");
+
+		for (const TCHAR* PhaseName : PhaseNames) {
+			Csv += FString::Printf(TEXT(",%s (ms),%s (calls)"), PhaseName, PhaseName);
+		}
+
+		Csv += LINE_TERMINATOR;
+
+		for (const FAssetRecord& Record : Records) {
+			Csv += FString::Printf(TEXT("\"%s\",%s,%lld,%.3f"), *Record.Name.Replace(TEXT("\""), TEXT("\"\"")), *Record.Type, Record.Bytes, ToMilliseconds(Record.Cycles));
+
+			for (const FPhaseRecord& Phase : Record.Phases) {
+				Csv += FString::Printf(TEXT(",%.3f,%d"), ToMilliseconds(Phase.Cycles), Phase.Calls);
+			}
+
+			Csv += LINE_TERMINATOR;
+		}
+
+		const FString ReportFile = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset") / TEXT("Profiles") / FString::Printf(TEXT("Import_%s.csv"), *FDateTime::Now().ToString());
+		FFileHelper::SaveStringToFile(Csv, *ReportFile);
+
+		/* Slowest assets in the message log */
+		TArray<const FAssetRecord*> Sorted;
+		for (const FAssetRecord& Record : Records) {
+			Sorted.Add(&Record);
+		}
+
+		Sorted.Sort([](const FAssetRecord& A, const FAssetRecord& B) {
+			return A.Cycles > B.Cycles;
+		});
+
+		FMessageLog MessageLogger = FMessageLog(FName("JsonAsAsset"));
+
+		MessageLogger.Message(EMessageSeverity::Info, FText::FromString(FString::Printf(TEXT("Imported %d assets in %.1f ms, profile written to %s"),
+			Records.Num(), ToMilliseconds(FPlatformTime::Cycles64() - BatchStartCycles), *FPaths::ConvertRelativePathToFull(ReportFile))));
+
+		for (int32 Index = 0; Index < FMath::Min(Sorted.Num(), FImportProfiler::SlowestAssetCount); Index++) {
+			const FAssetRecord* Record = Sorted[Index];
+
+			/* Name the phase that took longest */
+			int32 SlowestPhase = 0;
+			for (int32 Phase = 1; Phase < PhaseCount; Phase++) {
+				if (Record->Phases[Phase].Cycles > Record->Phases[SlowestPhase].Cycles) {
+					SlowestPhase = Phase;
+				}
+			}
+
+			MessageLogger.Message(EMessageSeverity::Info, FText::FromString(FString::Printf(TEXT("Slowest #%d: %s (%s) %.1f ms, mostly %s (%.1f ms)"),
+				Index + 1, *Record->Name, *Record->Type, ToMilliseconds(Record->Cycles), PhaseNames[SlowestPhase], ToMilliseconds(Record->Phases[SlowestPhase].Cycles))));
+		}
+	}
+}
+
+FImportProfiler::FBatchScope::FBatchScope() {
+	if (!IsInGameThread()) return;
+
+	if (BatchDepth++ == 0) {
+		bRecording = GetDefault<UJsonAsAssetSettings>()->bWriteImportProfiles;
+		BatchStartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FImportProfiler::FBatchScope::~FBatchScope() {
+	if (!IsInGameThread()) return;
+
+	if (--BatchDepth == 0) {
+		if (bRecording) {
+			WriteReport();
+		}
+
+		Records.Empty();
+		ActiveAssets.Empty();
+		Pending = FAssetRecord();
+		bRecording = false;
+	}
+}
+
+FImportProfiler::FAssetScope::FAssetScope(const FString& Name, const FString& Type, const FString& File)
+	: bActive(bRecording && IsInGameThread()) {
+	if (!bActive) return;
+
+	FAssetRecord& Record = Records.Add_GetRef(MoveTemp(Pending));
+	Pending = FAssetRecord();
+
+	Record.Name = Name;
+	Record.Type = Type;
+	Record.Bytes = FMath::Max<int64>(IFileManager::Get().FileSize(*File), 0);
+	Record.StartCycles = FPlatformTime::Cycles64();
+
+	/* Pending phases already finished, they count towards the total too */
+	for (const FPhaseRecord& Phase : Record.Phases) {
+		Record.Cycles += Phase.Cycles;
+	}
+
+	ActiveAssets.Add(Records.Num() - 1);
+}
+
+FImportProfiler::FAssetScope::~FAssetScope() {
+	if (!bActive || ActiveAssets.Num() == 0) return;
+
+	FAssetRecord& Record = Records[ActiveAssets.Pop()];
+	Record.Cycles += FPlatformTime::Cycles64() - Record.StartCycles;
+}
+
+FImportProfiler::FPhaseScope::FPhaseScope(const EImportPhase InPhase)
+	: Phase(InPhase), StartCycles(0), bActive(bRecording && IsInGameThread()) {
+	if (!bActive) return;
+
+	FPhaseRecord& Record = GetCurrentRecord()->Phases[static_cast<int32>(Phase)];
+	Record.Calls++;
+
+	if (Record.Depth++ == 0) {
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FImportProfiler::FPhaseScope::~FPhaseScope() {
+	if (!bActive || !bRecording) return;
+
+	FPhaseRecord& Record = GetCurrentRecord()->Phases[static_cast<int32>(Phase)];
+
+	if (--Record.Depth == 0 && StartCycles != 0) {
+		Record.Cycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+}
@@ -0,0 +1,602 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Json/JsonBinaryCache.h"
+
+#include "Algo/AllOf.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+const TCHAR* FJsonBinaryCache::ContentType = TEXT("application/x-jsonasasset-binary");
+
+namespace {
+	/* "JAAB" */
+	constexpr uint32 CacheMagic = 0x4241414A;
+
+	/* Of the files in the export cache. Bump when the layout, or what the parser produces, changes. */
+	constexpr uint32 CacheVersion = 3;
+
+	/*
+	 * Layout:
+	 *   Magic, Version, StringCount (uint32)
+	 *   Strings: Length (uint32), UTF-8 bytes
+	 *   Root value
+	 *
+	 * Each value is a tag byte followed by its payload. Strings, keys and values alike,
+	 * are indices into the string table, so repeated names and paths are stored once.
+	 * Whole numbers that fit are stored as Int32 rather than doubles, alone or as a whole
+	 * packed array, most of an export's numbers are indices, counts and enum-like values.
+	 */
+	enum class ETag : uint8 {
+		Null,
+		False,
+		True,
+		Number,
+		String,
+		Array,
+		Object,
+		PackedNumbers,
+		Int32,
+		PackedInt32s
+	};
+
+	/* FString keys compare ignoring case by default, "Roughness" and "roughness" are different strings here */
+	struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, uint32, false> {
+		static FORCEINLINE bool Matches(const FString& A, const FString& B) {
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+
+		static FORCEINLINE uint32 GetKeyHash(const FString& Key) {
+			return FCrc::StrCrc32(*Key);
+		}
+	};
+
+	/* Deeper than any export nests, each level is a stack frame while reading */
+	constexpr int32 MaxDepth = 512;
+
+	bool IsInt32(const double Number) {
+		return Number >= MIN_int32 && Number <= MAX_int32 && static_cast<double>(static_cast<int32>(Number)) == Number;
+	}
+
+	class FCacheWriter {
+	public:
+		void Write(const TSharedPtr<FJsonValue>& Root) {
+			WriteValue(Root);
+		}
+
+		/* Header and string table, then the values written so far */
+		void Finish(TArray<uint8>& Out, const uint32 Version) const {
+			Out.Reset(Strings.Num() * 16 + Values.Num() + 12);
+
+			Append(Out, CacheMagic);
+			Append(Out, Version);
+			Append(Out, static_cast<uint32>(Strings.Num()));
+
+			for (const FString& String : Strings) {
+				const FTCHARToUTF8 Converted(*String);
+
+				Append(Out, static_cast<uint32>(Converted.Length()));
+				Out.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+			}
+
+			Out.Append(Values);
+		}
+
+	private:
+		template <typename T>
+		static void Append(TArray<uint8>& Out, const T Value) {
+			Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+		}
+
+		uint32 AddString(const FString& String) {
+			if (const uint32* Index = StringIndices.Find(String)) {
+				return *Index;
+			}
+
+			const uint32 Index = Strings.Num();
+			Strings.Add(String);
+			StringIndices.Add(String, Index);
+
+			return Index;
+		}
+
+		void WriteValue(const TSharedPtr<FJsonValue>& Value) {
+			if (!Value.IsValid()) {
+				Values.Add(static_cast<uint8>(ETag::Null));
+				return;
+			}
+
+			if (const FJsonValuePackedNumbers* Packed = FJsonValuePackedNumbers::Cast(Value)) {
+				const TArrayView<const double> Numbers = Packed->GetNumbers();
+
+				if (Algo::AllOf(Numbers, IsInt32)) {
+					Values.Add(static_cast<uint8>(ETag::PackedInt32s));
+					Append(Values, static_cast<uint32>(Numbers.Num()));
+
+					for (const double Number : Numbers) {
+						Append(Values, static_cast<int32>(Number));
+					}
+
+					return;
+				}
+
+				Values.Add(static_cast<uint8>(ETag::PackedNumbers));
+				Append(Values, static_cast<uint32>(Numbers.Num()));
+				Values.Append(reinterpret_cast<const uint8*>(Numbers.GetData()), Numbers.Num() * sizeof(double));
+
+				return;
+			}
+
+			switch (Value->Type) {
+			case EJson::Boolean:
+				Values.Add(static_cast<uint8>(Value->AsBool() ? ETag::True : ETag::False));
+				break;
+			case EJson::Number: {
+				const double Number = Value->AsNumber();
+
+				if (IsInt32(Number)) {
+					Values.Add(static_cast<uint8>(ETag::Int32));
+					Append(Values, static_cast<int32>(Number));
+				} else {
+					Values.Add(static_cast<uint8>(ETag::Number));
+					Append(Values, Number);
+				}
+
+				break;
+			}
+			case EJson::String:
+				Values.Add(static_cast<uint8>(ETag::String));
+				Append(Values, AddString(Value->AsString()));
+				break;
+			case EJson::Array: {
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+
+				Values.Add(static_cast<uint8>(ETag::Array));
+				Append(Values, static_cast<uint32>(Array.Num()));
+
+				for (const TSharedPtr<FJsonValue>& Element : Array) {
+					WriteValue(Element);
+				}
+
+				break;
+			}
+			case EJson::Object: {
+				const TSharedPtr<FJsonObject> Object = Value->AsObject();
+
+				Values.Add(static_cast<uint8>(ETag::Object));
+				Append(Values, static_cast<uint32>(Object->Values.Num()));
+
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values) {
+					Append(Values, AddString(Pair.Key));
+					WriteValue(Pair.Value);
+				}
+
+				break;
+			}
+			default:
+				Values.Add(static_cast<uint8>(ETag::Null));
+				break;
+			}
+		}
+
+		TArray<FString> Strings;
+		TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> StringIndices;
+
+		TArray<uint8> Values;
+	};
+
+	class FCacheReader {
+	public:
+		FCacheReader(const TSharedPtr<FJsonSource>& InSource, const uint32 InVersion)
+			: Source(InSource), ExpectedVersion(InVersion), Data(reinterpret_cast<const uint8*>(InSource->GetData())), Size(InSource->Num()) {
+			True = MakeShared<FJsonValueBoolean>(true);
+			False = MakeShared<FJsonValueBoolean>(false);
+			Null = MakeShared<FJsonValueNull>();
+
+			Stats.Bytes = Size;
+			Stats.bFromCache = true;
+		}
+
+		TSharedPtr<FJsonValue> Read() {
+			uint32 Magic, Version, StringCount;
+
+			if (!ReadRaw(Magic) || !ReadRaw(Version) || !ReadRaw(StringCount)) return nullptr;
+			if (Magic != CacheMagic || Version != ExpectedVersion) return nullptr;
+
+			/* Each string takes at least its length, a count beyond that is a corrupt or hostile file */
+			if (StringCount > static_cast<uint64>(Size - Position) / sizeof(uint32)) return nullptr;
+
+			StringOffsets.SetNumUninitialized(StringCount);
+			StringLengths.SetNumUninitialized(StringCount);
+
+			for (uint32 Index = 0; Index < StringCount; Index++) {
+				uint32 Length;
+				if (!ReadRaw(Length) || Position + Length > Size) return nullptr;
+
+				StringOffsets[Index] = Position;
+				StringLengths[Index] = Length;
+
+				Position += Length;
+			}
+
+			/* Filled as they're first used */
+			Keys.SetNum(StringCount);
+			KeyConverted.Init(false, StringCount);
+			StringValues.SetNum(StringCount);
+
+			TSharedPtr<FJsonValue> Root = ReadValue();
+
+			return Position == Size ? Root : nullptr;
+		}
+
+		FJsonReadStats Stats;
+
+	private:
+		template <typename T>
+		bool ReadRaw(T& Out) {
+			if (Position + static_cast<int64>(sizeof(T)) > Size) return false;
+
+			FMemory::Memcpy(&Out, Data + Position, sizeof(T));
+			Position += sizeof(T);
+
+			return true;
+		}
+
+		bool ReadKey(FString& OutKey) {
+			uint32 Index;
+			if (!ReadRaw(Index) || Index >= static_cast<uint32>(Keys.Num())) return false;
+
+			if (!KeyConverted[Index]) {
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + StringOffsets[Index]), StringLengths[Index]);
+				Keys[Index] = FString(Converted.Length(), Converted.Get());
+				KeyConverted[Index] = true;
+			}
+
+			OutKey = Keys[Index];
+			return true;
+		}
+
+		TSharedPtr<FJsonValue> ReadValue() {
+			if (Depth >= MaxDepth) return nullptr;
+
+			TGuardValue<int32> DepthGuard(Depth, Depth + 1);
+
+			uint8 Tag;
+			if (!ReadRaw(Tag)) return nullptr;
+
+			Stats.Values++;
+
+			switch (static_cast<ETag>(Tag)) {
+			case ETag::Null:
+				return Null;
+			case ETag::False:
+				return False;
+			case ETag::True:
+				return True;
+			case ETag::Number: {
+				double Number;
+				if (!ReadRaw(Number)) return nullptr;
+
+				return MakeShared<FJsonValueNumber>(Number);
+			}
+			case ETag::Int32: {
+				int32 Number;
+				if (!ReadRaw(Number)) return nullptr;
+
+				return MakeShared<FJsonValueNumber>(Number);
+			}
+			case ETag::String: {
+				uint32 Index;
+				if (!ReadRaw(Index) || Index >= static_cast<uint32>(StringValues.Num())) return nullptr;
+
+				/* Values can't be modified, equal strings share one */
+				TSharedPtr<FJsonValue>& String = StringValues[Index];
+
+				if (!String.IsValid()) {
+					String = MakeShared<FJsonValueUtf8String>(Source, StringOffsets[Index], StringLengths[Index]);
+					Stats.Slices++;
+				}
+
+				return String;
+			}
+			case ETag::Array: {
+				uint32 Count;
+				if (!ReadRaw(Count) || Position + Count > Size) return nullptr;
+
+				TArray<TSharedPtr<FJsonValue>> Array;
+				Array.Reserve(Count);
+
+				for (uint32 Index = 0; Index < Count; Index++) {
+					TSharedPtr<FJsonValue> Element = ReadValue();
+					if (!Element.IsValid()) return nullptr;
+
+					Array.Add(MoveTemp(Element));
+				}
+
+				return MakeShared<FJsonValueArray>(Array);
+			}
+			case ETag::Object: {
+				uint32 Count;
+				if (!ReadRaw(Count) || Position + Count > Size) return nullptr;
+
+				TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+				Object->Values.Reserve(Count);
+
+				Stats.Objects++;
+
+				for (uint32 Index = 0; Index < Count; Index++) {
+					FString Key;
+					if (!ReadKey(Key)) return nullptr;
+
+					TSharedPtr<FJsonValue> Value = ReadValue();
+					if (!Value.IsValid()) return nullptr;
+
+					Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+				}
+
+				return MakeShared<FJsonValueObject>(Object);
+			}
+			case ETag::PackedNumbers: {
+				uint32 Count;
+				if (!ReadRaw(Count) || Position + static_cast<int64>(Count) * sizeof(double) > Size) return nullptr;
+
+				TArray<double> Numbers;
+				Numbers.SetNumUninitialized(Count);
+				FMemory::Memcpy(Numbers.GetData(), Data + Position, Count * sizeof(double));
+
+				Position += Count * sizeof(double);
+				Stats.PackedNumbers += Count;
+
+				return MakeShared<FJsonValuePackedNumbers>(MoveTemp(Numbers));
+			}
+			case ETag::PackedInt32s: {
+				uint32 Count;
+				if (!ReadRaw(Count) || Position + static_cast<int64>(Count) * sizeof(int32) > Size) return nullptr;
+
+				TArray<double> Numbers;
+				Numbers.SetNumUninitialized(Count);
+
+				const uint8* Packed = Data + Position;
+
+				for (uint32 Index = 0; Index < Count; Index++) {
+					int32 Number;
+					FMemory::Memcpy(&Number, Packed + Index * sizeof(int32), sizeof(int32));
+
+					Numbers[Index] = Number;
+				}
+
+				Position += Count * sizeof(int32);
+				Stats.PackedNumbers += Count;
+
+				return MakeShared<FJsonValuePackedNumbers>(MoveTemp(Numbers));
+			}
+			default:
+				return nullptr;
+			}
+		}
+
+		TSharedPtr<FJsonSource> Source;
+		uint32 ExpectedVersion;
+
+		const uint8* Data;
+		int64 Size;
+		int64 Position = 0;
+
+		/* Arrays and objects the value being read is in */
+		int32 Depth = 0;
+
+		TArray<int64> StringOffsets;
+		TArray<int32> StringLengths;
+
+		TArray<FString> Keys;
+		TBitArray<> KeyConverted;
+		TArray<TSharedPtr<FJsonValue>> StringValues;
+
+		TSharedPtr<FJsonValue> True;
+		TSharedPtr<FJsonValue> False;
+		TSharedPtr<FJsonValue> Null;
+	};
+}
+
+bool FJsonBinaryCache::ReadFile(const FString& File, TArray<TSharedPtr<FJsonValue>>& OutArray, FJsonReadStats* OutStats) {
+	const TSharedPtr<FJsonSource> Source = FJsonSource::Open(File);
+
+	if (!Source.IsValid()) {
+		UE_LOG(LogJson, Error, TEXT("Failed to open \"%s\""), *File);
+		return false;
+	}
+
+	const TSharedPtr<FJsonValue> Value = Read(Source, File, OutStats);
+
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (!Value.IsValid() || !Value->TryGetArray(Array)) {
+		return false;
+	}
+
+	OutArray = *Array;
+	return true;
+}
+
+TSharedPtr<FJsonValue> FJsonBinaryCache::ReadBuffer(TArray<uint8>&& Bytes, const FString& Name, FJsonReadStats* OutStats) {
+	/* Already binary, nothing to parse or cache */
+	if (IsEncoded(Bytes)) {
+		TSharedPtr<FJsonValue> Value = Decode(MoveTemp(Bytes), OutStats);
+
+		if (!Value.IsValid()) {
+			UE_LOG(LogJson, Error, TEXT("Failed to decode binary export \"%s\""), *Name);
+		}
+
+		return Value;
+	}
+
+	return Read(FJsonSource::FromBuffer(MoveTemp(Bytes)), Name, OutStats);
+}
+
+FString FJsonBinaryCache::GetCacheDirectory() {
+	return FPaths::ProjectIntermediateDir() / TEXT("JsonAsAsset") / TEXT("ExportCache");
+}
+
+void FJsonBinaryCache::Trim(const FString& Directory, const int64 MaxBytes, const FTimespan MaxAge) {
+	IFileManager& FileManager = IFileManager::Get();
+
+	/* Files of another layout are never read again, their contents would only be parsed and cached anew */
+	const FString VersionFile = Directory / TEXT("Version.txt");
+
+	FString Version;
+	FFileHelper::LoadFileToString(Version, *VersionFile);
+
+	if (Version != LexToString(CacheVersion)) {
+		FileManager.DeleteDirectory(*Directory, false, true);
+		FFileHelper::SaveStringToFile(LexToString(CacheVersion), *VersionFile);
+
+		return;
+	}
+
+	struct FCacheFile {
+		FString Path;
+		int64 Size;
+		FDateTime LastUsed;
+	};
+
+	TArray<FCacheFile> Files;
+	int64 TotalBytes = 0;
+
+	FileManager.IterateDirectoryStat(*Directory, [&Files, &TotalBytes](const TCHAR* Path, const FFileStatData& StatData) {
+		if (!StatData.bIsDirectory && FPaths::GetExtension(Path) == TEXT("jbin")) {
+			Files.Add({ Path, StatData.FileSize, StatData.ModificationTime });
+			TotalBytes += StatData.FileSize;
+		}
+
+		return true;
+	});
+
+	Files.Sort([](const FCacheFile& A, const FCacheFile& B) {
+		return A.LastUsed < B.LastUsed;
+	});
+
+	const FDateTime Cutoff = FDateTime::UtcNow() - MaxAge;
+
+	int32 NumDeleted = 0;
+	int64 DeletedBytes = 0;
+
+	/* Least recently used first */
+	for (const FCacheFile& File : Files) {
+		if (File.LastUsed >= Cutoff && TotalBytes <= MaxBytes) break;
+
+		/* Fails while an import has it mapped, it's used anyway */
+		if (FileManager.Delete(*File.Path, false, false, true)) {
+			TotalBytes -= File.Size;
+			DeletedBytes += File.Size;
+			NumDeleted++;
+		}
+	}
+
+	if (NumDeleted > 0) {
+		UE_LOG(LogJson, Log, TEXT("Evicted %d files (%.1f MB) from the export cache, %.1f MB left"), NumDeleted, DeletedBytes / (1024.0 * 1024.0), TotalBytes / (1024.0 * 1024.0));
+	}
+}
+
+FString FJsonBinaryCache::GetWireContentType() {
+	return FString::Printf(TEXT("%s; version=%u"), ContentType, WireVersion);
+}
+
+bool FJsonBinaryCache::IsEncoded(const TArray<uint8>& Bytes) {
+	uint32 Magic = 0;
+
+	if (Bytes.Num() >= static_cast<int32>(sizeof(Magic))) {
+		FMemory::Memcpy(&Magic, Bytes.GetData(), sizeof(Magic));
+	}
+
+	return Magic == CacheMagic;
+}
+
+void FJsonBinaryCache::Encode(const TSharedPtr<FJsonValue>& Value, TArray<uint8>& OutBytes) {
+	FCacheWriter Writer;
+	Writer.Write(Value);
+	Writer.Finish(OutBytes, WireVersion);
+}
+
+TSharedPtr<FJsonValue> FJsonBinaryCache::Decode(TArray<uint8>&& Bytes, FJsonReadStats* OutStats) {
+	const double StartTime = FPlatformTime::Seconds();
+
+	FCacheReader Reader(FJsonSource::FromBuffer(MoveTemp(Bytes)), WireVersion);
+	TSharedPtr<FJsonValue> Value = Reader.Read();
+
+	if (OutStats) {
+		*OutStats = Reader.Stats;
+		OutStats->Seconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	return Value;
+}
+
+TSharedPtr<FJsonValue> FJsonBinaryCache::Read(const TSharedPtr<FJsonSource>& Source, const FString& Name, FJsonReadStats* OutStats) {
+	const double StartTime = FPlatformTime::Seconds();
+
+	FMD5 Hash;
+	Hash.Update(reinterpret_cast<const uint8*>(Source->GetData()), Source->Num());
+
+	FMD5Hash Digest;
+	Digest.Set(Hash);
+
+	const FString CacheFile = GetCacheDirectory() / LexToString(Digest) + TEXT(".jbin");
+
+	FJsonReadStats Stats;
+	TSharedPtr<FJsonValue> Value;
+
+	if (FPaths::FileExists(CacheFile)) {
+		/* Marks it as recently used for Trim */
+		IFileManager::Get().SetTimeStamp(*CacheFile, FDateTime::UtcNow());
+
+		Value = Load(CacheFile, Stats);
+
+		if (!Value.IsValid()) {
+			UE_LOG(LogJson, Warning, TEXT("Discarding unreadable export cache \"%s\""), *CacheFile);
+		}
+	}
+
+	if (!Value.IsValid()) {
+		Value = FMappedJsonReader::Read(Source, Name, &Stats);
+
+		if (Value.IsValid()) {
+			Save(CacheFile, Value);
+		}
+	}
+
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	if (OutStats) {
+		*OutStats = Stats;
+	}
+
+	return Value;
+}
+
+TSharedPtr<FJsonValue> FJsonBinaryCache::Load(const FString& CacheFile, FJsonReadStats& OutStats) {
+	const TSharedPtr<FJsonSource> Source = FJsonSource::Open(CacheFile);
+	if (!Source.IsValid()) return nullptr;
+
+	FCacheReader Reader(Source, CacheVersion);
+	TSharedPtr<FJsonValue> Value = Reader.Read();
+
+	OutStats = Reader.Stats;
+
+	return Value;
+}
+
+void FJsonBinaryCache::Save(const FString& CacheFile, const TSharedPtr<FJsonValue>& Value) {
+	FCacheWriter Writer;
+	Writer.Write(Value);
+
+	TArray<uint8> Bytes;
+	Writer.Finish(Bytes, CacheVersion);
+
+	/* Written next to it and moved in place, a cancelled write never leaves a partial file behind */
+	const FString TempFile = CacheFile + TEXT(".tmp");
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFile) || !IFileManager::Get().Move(*CacheFile, *TempFile, true, true)) {
+		UE_LOG(LogJson, Warning, TEXT("Failed to write export cache \"%s\""), *CacheFile);
+		IFileManager::Get().Delete(*TempFile);
+	}
+}
@@ -0,0 +1,103 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Json/JsonImportScope.h"
+
+#include "Containers/Ticker.h"
+#include "Utilities/Compatibility.h"
+
+namespace {
+	/* Exports waiting to be released, oldest first */
+	TArray<TSharedPtr<FJsonValue>> ReleaseQueue;
+	int32 ReleaseHead = 0;
+
+	FJsonReleaseStats CurrentRelease;
+	FJsonReleaseStats LastRelease;
+
+	bool bReleaseTickerActive = false;
+
+	bool ReleaseTick(float DeltaTime) {
+		if (FJsonImportScope::ReleaseBatch()) {
+			return true;
+		}
+
+		bReleaseTickerActive = false;
+		return false;
+	}
+}
+
+FJsonImportScope::~FJsonImportScope() {
+	UE_LOG(LogJson, Log, TEXT("%s \"%s\" in %.2f ms: %lld bytes, %lld objects, %lld values (%lld strings left in place, %lld packed numbers)"),
+		Stats.bFromCache ? TEXT("Loaded cached") : TEXT("Parsed"), *FPaths::GetCleanFilename(File), Stats.Seconds * 1000.0,
+		Stats.Bytes, Stats.Objects, Stats.Values, Stats.Slices, Stats.PackedNumbers);
+
+	if (Exports.Num() == 0) {
+		return;
+	}
+
+	/* No ticker outside of the game thread, release right away */
+	if (!IsInGameThread()) {
+		return;
+	}
+
+	ReleaseQueue.Append(MoveTemp(Exports));
+
+	if (!bReleaseTickerActive) {
+		bReleaseTickerActive = true;
+
+#if ENGINE_UE5
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&ReleaseTick));
+#else
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&ReleaseTick));
+#endif
+	}
+}
+
+void FJsonImportScope::Flush() {
+	ReleaseQueue.Empty();
+	ReleaseHead = 0;
+	CurrentRelease = FJsonReleaseStats();
+}
+
+bool FJsonImportScope::ReleaseBatch() {
+	if (ReleaseHead >= ReleaseQueue.Num()) {
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	/* One export at a time, a single huge export still goes in one step */
+	while (ReleaseHead < ReleaseQueue.Num()) {
+		ReleaseQueue[ReleaseHead++].Reset();
+
+		if (FPlatformTime::Seconds() - StartTime > ReleaseBudgetSeconds) {
+			break;
+		}
+	}
+
+	const double BatchSeconds = FPlatformTime::Seconds() - StartTime;
+
+	CurrentRelease.Batches++;
+	CurrentRelease.Seconds += BatchSeconds;
+	CurrentRelease.LongestBatchSeconds = FMath::Max(CurrentRelease.LongestBatchSeconds, BatchSeconds);
+
+	if (ReleaseHead < ReleaseQueue.Num()) {
+		return true;
+	}
+
+	CurrentRelease.Exports = ReleaseQueue.Num();
+
+	UE_LOG(LogJson, Log, TEXT("Released %d exports in %.2f ms over %d frames, longest frame %.2f ms"),
+		CurrentRelease.Exports, CurrentRelease.Seconds * 1000.0, CurrentRelease.Batches, CurrentRelease.LongestBatchSeconds * 1000.0);
+
+	LastRelease = CurrentRelease;
+	CurrentRelease = FJsonReleaseStats();
+
+	ReleaseQueue.Empty();
+	ReleaseHead = 0;
+
+	return false;
+}
+
+const FJsonReleaseStats& FJsonImportScope::GetLastRelease() {
+	return LastRelease;
+}
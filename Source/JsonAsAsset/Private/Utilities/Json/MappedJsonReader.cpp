@@ -0,0 +1,653 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Json/MappedJsonReader.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/CString.h"
+
+FJsonSource::~FJsonSource() {
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+TSharedPtr<FJsonSource> FJsonSource::Open(const FString& File) {
+	TSharedPtr<FJsonSource> Source = MakeShareable(new FJsonSource());
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	if (IMappedFileHandle* Handle = PlatformFile.OpenMapped(*File)) {
+		Source->MappedHandle.Reset(Handle);
+
+		if (Handle->GetFileSize() > 0) {
+			Source->MappedRegion.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+		}
+	}
+
+	if (Source->MappedRegion.IsValid()) {
+		Source->Data = reinterpret_cast<const ANSICHAR*>(Source->MappedRegion->GetMappedPtr());
+		Source->Size = Source->MappedRegion->GetMappedSize();
+	} else {
+		Source->MappedHandle.Reset();
+
+		if (!FFileHelper::LoadFileToArray(Source->Buffer, *File)) {
+			return nullptr;
+		}
+
+		Source->Data = reinterpret_cast<const ANSICHAR*>(Source->Buffer.GetData());
+		Source->Size = Source->Buffer.Num();
+	}
+
+	return Source;
+}
+
+TSharedPtr<FJsonSource> FJsonSource::FromBuffer(TArray<uint8>&& Bytes) {
+	TSharedPtr<FJsonSource> Source = MakeShareable(new FJsonSource());
+
+	Source->Buffer = MoveTemp(Bytes);
+	Source->Data = reinterpret_cast<const ANSICHAR*>(Source->Buffer.GetData());
+	Source->Size = Source->Buffer.Num();
+
+	return Source;
+}
+
+bool FJsonValueUtf8String::TryGetString(FString& OutString) const {
+	const FUTF8ToTCHAR Converted(Source->GetData() + Offset, Length);
+	OutString = FString(Converted.Length(), Converted.Get());
+
+	return true;
+}
+
+/* Same conversions FJsonValueString does */
+bool FJsonValueUtf8String::TryGetNumber(double& OutDouble) const {
+	FString String;
+	TryGetString(String);
+
+	if (String.IsNumeric()) {
+		OutDouble = FCString::Atod(*String);
+		return true;
+	}
+
+	return false;
+}
+
+bool FJsonValueUtf8String::TryGetBool(bool& OutBool) const {
+	FString String;
+	TryGetString(String);
+
+	OutBool = String.ToBool();
+	return true;
+}
+
+bool FJsonValuePackedNumbers::TryGetArray(const TArray<TSharedPtr<FJsonValue>>*& OutArray) const {
+	FScopeLock Lock(&ExpandLock);
+
+	if (!bExpanded) {
+		Expanded.Reserve(Numbers.Num());
+
+		for (const double Number : Numbers) {
+			Expanded.Add(MakeShared<FJsonValueNumber>(Number));
+		}
+
+		bExpanded = true;
+	}
+
+	OutArray = &Expanded;
+	return true;
+}
+
+namespace {
+	/*
+	 * Type tag for Cast. The editor is built without RTTI and FJsonValue has no field to spare, but
+	 * every object of a single-inheritance polymorphic class starts with its class's vtable pointer.
+	 * FJsonValuePackedNumbers' vtable is only emitted in this file, next to TryGetArray, so its
+	 * address identifies the class.
+	 */
+	const void* GetVTable(const FJsonValue* Value) {
+		return *reinterpret_cast<const void* const*>(Value);
+	}
+
+	const void* GetPackedNumbersVTable() {
+		static const FJsonValuePackedNumbers Reference((TArray<double>()));
+		static const void* VTable = GetVTable(&Reference);
+
+		return VTable;
+	}
+}
+
+const FJsonValuePackedNumbers* FJsonValuePackedNumbers::Cast(const FJsonValue* Value) {
+	if (Value == nullptr || Value->Type != EJson::Array) {
+		return nullptr;
+	}
+
+	return GetVTable(Value) == GetPackedNumbersVTable() ? static_cast<const FJsonValuePackedNumbers*>(Value) : nullptr;
+}
+
+namespace {
+	/* Deeper than any export nests, each level is a few stack frames while parsing */
+	constexpr int32 MaxDepth = 512;
+
+	/* Key bytes in the source, used to look up already converted keys */
+	struct FKeySlice {
+		const ANSICHAR* Data;
+		int32 Length;
+
+		bool operator==(const FKeySlice& Other) const {
+			return Length == Other.Length && FMemory::Memcmp(Data, Other.Data, Length) == 0;
+		}
+
+		friend uint32 GetTypeHash(const FKeySlice& Slice) {
+			return FCrc::MemCrc32(Slice.Data, Slice.Length);
+		}
+	};
+
+	class FUtf8Parser {
+	public:
+		explicit FUtf8Parser(const TSharedPtr<FJsonSource>& InSource)
+			: Source(InSource), Data(InSource->GetData()), Size(InSource->Num()), Position(0) {
+			/* Literals can't be modified, one of each is shared by the whole file */
+			True = MakeShared<FJsonValueBoolean>(true);
+			False = MakeShared<FJsonValueBoolean>(false);
+			Null = MakeShared<FJsonValueNull>();
+
+			Stats.Bytes = Size;
+
+			/* UTF-8 byte order mark */
+			if (Size >= 3 && static_cast<uint8>(Data[0]) == 0xEF && static_cast<uint8>(Data[1]) == 0xBB && static_cast<uint8>(Data[2]) == 0xBF) {
+				Position = 3;
+			}
+		}
+
+		TSharedPtr<FJsonValue> Parse() {
+			TSharedPtr<FJsonValue> Value = ParseValue();
+
+			SkipWhitespace();
+
+			if (Value.IsValid() && Position != Size) {
+				return Fail(TEXT("Unexpected data after the root value"));
+			}
+
+			return Value;
+		}
+
+		FString Error;
+		int64 ErrorPosition = 0;
+
+		FJsonReadStats Stats;
+
+	private:
+		/* Arrays and objects the value being parsed is in */
+		int32 Depth = 0;
+
+		TSharedPtr<FJsonValue> Fail(const TCHAR* Message) {
+			if (Error.IsEmpty()) {
+				Error = Message;
+				ErrorPosition = Position;
+			}
+
+			return nullptr;
+		}
+
+		void SkipWhitespace() {
+			while (Position < Size) {
+				const ANSICHAR Character = Data[Position];
+
+				if (Character != ' ' && Character != '\t' && Character != '\n' && Character != '\r') {
+					break;
+				}
+
+				Position++;
+			}
+		}
+
+		bool Match(const ANSICHAR* Literal, const int32 Length) {
+			if (Position + Length > Size || FMemory::Memcmp(Data + Position, Literal, Length) != 0) {
+				return false;
+			}
+
+			Position += Length;
+			return true;
+		}
+
+		TSharedPtr<FJsonValue> ParseValue() {
+			SkipWhitespace();
+
+			if (Position >= Size) {
+				return Fail(TEXT("Unexpected end of file"));
+			}
+
+			switch (Data[Position]) {
+			case '{':
+			case '[': {
+				if (Depth >= MaxDepth) {
+					return Fail(TEXT("Nested too deeply"));
+				}
+
+				TGuardValue<int32> DepthGuard(Depth, Depth + 1);
+				return Data[Position] == '{' ? ParseObject() : ParseArray();
+			}
+			case '"':
+				return ParseStringValue();
+			case 't':
+				if (Match("true", 4)) return True;
+				break;
+			case 'f':
+				if (Match("false", 5)) return False;
+				break;
+			case 'n':
+				if (Match("null", 4)) return Null;
+				break;
+			default:
+				return ParseNumber();
+			}
+
+			return Fail(TEXT("Invalid literal"));
+		}
+
+		TSharedPtr<FJsonValue> ParseObject() {
+			/* '{' */
+			Position++;
+
+			TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+			Stats.Objects++;
+
+			SkipWhitespace();
+
+			if (Position < Size && Data[Position] == '}') {
+				Position++;
+				Stats.Values++;
+				return MakeShared<FJsonValueObject>(Object);
+			}
+
+			while (true) {
+				SkipWhitespace();
+
+				if (Position >= Size || Data[Position] != '"') {
+					return Fail(TEXT("Expected a key"));
+				}
+
+				FString Key;
+				if (!ParseKey(Key)) return nullptr;
+
+				SkipWhitespace();
+
+				if (Position >= Size || Data[Position] != ':') {
+					return Fail(TEXT("Expected ':'"));
+				}
+
+				Position++;
+
+				TSharedPtr<FJsonValue> Value = ParseValue();
+				if (!Value.IsValid()) return nullptr;
+
+				Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+
+				SkipWhitespace();
+
+				if (Position < Size && Data[Position] == ',') {
+					Position++;
+					continue;
+				}
+
+				if (Position < Size && Data[Position] == '}') {
+					Position++;
+					break;
+				}
+
+				return Fail(TEXT("Expected ',' or '}'"));
+			}
+
+			Stats.Values++;
+			return MakeShared<FJsonValueObject>(Object);
+		}
+
+		static bool IsNumberStart(const ANSICHAR Character) {
+			return (Character >= '0' && Character <= '9') || Character == '-';
+		}
+
+		TSharedPtr<FJsonValue> ParseArray() {
+			/* '[' */
+			Position++;
+
+			SkipWhitespace();
+
+			if (Position < Size && Data[Position] == ']') {
+				Position++;
+
+				Stats.Values++;
+				return MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>());
+			}
+
+			/* Read numbers into a packed buffer for as long as the array only has numbers */
+			TArray<double> Numbers;
+
+			while (Position < Size && IsNumberStart(Data[Position])) {
+				double Number;
+				if (!ParseNumber(Number)) return nullptr;
+
+				Numbers.Add(Number);
+
+				SkipWhitespace();
+
+				if (Position < Size && Data[Position] == ',') {
+					Position++;
+					SkipWhitespace();
+
+					continue;
+				}
+
+				if (Position < Size && Data[Position] == ']') {
+					Position++;
+					Stats.PackedNumbers += Numbers.Num();
+					Stats.Values++;
+
+					return MakeShared<FJsonValuePackedNumbers>(MoveTemp(Numbers));
+				}
+
+				return Fail(TEXT("Expected ',' or ']'"));
+			}
+
+			/* Mixed array, the numbers read so far become regular values */
+			TArray<TSharedPtr<FJsonValue>> Array;
+			Array.Reserve(Numbers.Num() + 1);
+
+			for (const double Number : Numbers) {
+				Array.Add(MakeShared<FJsonValueNumber>(Number));
+			}
+
+			Stats.Values += Numbers.Num();
+
+			while (true) {
+				TSharedPtr<FJsonValue> Value = ParseValue();
+				if (!Value.IsValid()) return nullptr;
+
+				Array.Add(MoveTemp(Value));
+
+				SkipWhitespace();
+
+				if (Position < Size && Data[Position] == ',') {
+					Position++;
+					continue;
+				}
+
+				if (Position < Size && Data[Position] == ']') {
+					Position++;
+					break;
+				}
+
+				return Fail(TEXT("Expected ',' or ']'"));
+			}
+
+			Stats.Values++;
+			return MakeShared<FJsonValueArray>(Array);
+		}
+
+		/*
+		 * Finds the end of the string starting at Position (on the opening quote).
+		 * Returns false if it isn't terminated.
+		 */
+		bool ScanString(int64& OutStart, int32& OutLength, bool& bOutEscaped) {
+			OutStart = ++Position;
+			bOutEscaped = false;
+
+			while (Position < Size) {
+				const ANSICHAR Character = Data[Position];
+
+				if (Character == '"') {
+					OutLength = static_cast<int32>(Position - OutStart);
+					Position++;
+
+					return true;
+				}
+
+				if (Character == '\\') {
+					bOutEscaped = true;
+					Position++;
+				}
+
+				Position++;
+			}
+
+			Fail(TEXT("Unterminated string"));
+			return false;
+		}
+
+		bool ParseKey(FString& OutKey) {
+			int64 Start;
+			int32 Length;
+			bool bEscaped;
+
+			if (!ScanString(Start, Length, bEscaped)) return false;
+
+			if (bEscaped) {
+				return Unescape(Start, Length, OutKey);
+			}
+
+			const FKeySlice Slice { Data + Start, Length };
+
+			if (const FString* Interned = Keys.Find(Slice)) {
+				OutKey = *Interned;
+				return true;
+			}
+
+			const FUTF8ToTCHAR Converted(Data + Start, Length);
+			OutKey = Keys.Add(Slice, FString(Converted.Length(), Converted.Get()));
+
+			return true;
+		}
+
+		TSharedPtr<FJsonValue> ParseStringValue() {
+			int64 Start;
+			int32 Length;
+			bool bEscaped;
+
+			if (!ScanString(Start, Length, bEscaped)) return nullptr;
+
+			if (bEscaped) {
+				FString String;
+				if (!Unescape(Start, Length, String)) return nullptr;
+
+				Stats.Values++;
+				return MakeShared<FJsonValueString>(String);
+			}
+
+			Stats.Values++;
+			Stats.Slices++;
+
+			return MakeShared<FJsonValueUtf8String>(Source, Start, Length);
+		}
+
+		static int32 HexDigit(const ANSICHAR Character) {
+			if (Character >= '0' && Character <= '9') return Character - '0';
+			if (Character >= 'a' && Character <= 'f') return Character - 'a' + 10;
+			if (Character >= 'A' && Character <= 'F') return Character - 'A' + 10;
+
+			return -1;
+		}
+
+		static void AppendUtf8(TArray<ANSICHAR>& Out, const uint32 CodePoint) {
+			if (CodePoint < 0x80) {
+				Out.Add(static_cast<ANSICHAR>(CodePoint));
+			} else if (CodePoint < 0x800) {
+				Out.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+			} else if (CodePoint < 0x10000) {
+				Out.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+			} else {
+				Out.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+				Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+			}
+		}
+
+		bool ReadHex4(const int64 At, uint32& OutValue) {
+			if (At + 4 > Size) return false;
+
+			OutValue = 0;
+
+			for (int32 Index = 0; Index < 4; Index++) {
+				const int32 Digit = HexDigit(Data[At + Index]);
+				if (Digit < 0) return false;
+
+				OutValue = (OutValue << 4) | Digit;
+			}
+
+			return true;
+		}
+
+		/* Decodes escapes into UTF-8, then converts once */
+		bool Unescape(const int64 Start, const int32 Length, FString& OutString) {
+			TArray<ANSICHAR> Bytes;
+			Bytes.Reserve(Length);
+
+			const int64 End = Start + Length;
+
+			for (int64 Index = Start; Index < End; Index++) {
+				const ANSICHAR Character = Data[Index];
+
+				if (Character != '\\') {
+					Bytes.Add(Character);
+					continue;
+				}
+
+				const ANSICHAR Escape = Data[++Index];
+
+				switch (Escape) {
+				case '"':  Bytes.Add('"'); break;
+				case '\\': Bytes.Add('\\'); break;
+				case '/':  Bytes.Add('/'); break;
+				case 'b':  Bytes.Add('\b'); break;
+				case 'f':  Bytes.Add('\f'); break;
+				case 'n':  Bytes.Add('\n'); break;
+				case 'r':  Bytes.Add('\r'); break;
+				case 't':  Bytes.Add('\t'); break;
+				case 'u': {
+					uint32 CodePoint;
+					if (!ReadHex4(Index + 1, CodePoint)) {
+						Position = Index;
+						Fail(TEXT("Invalid \\u escape"));
+						return false;
+					}
+
+					Index += 4;
+
+					/* Surrogate pair */
+					uint32 Low;
+					if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 6 < End && Data[Index + 1] == '\\' && Data[Index + 2] == 'u' && ReadHex4(Index + 3, Low) && Low >= 0xDC00 && Low <= 0xDFFF) {
+						CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+						Index += 6;
+					}
+
+					AppendUtf8(Bytes, CodePoint);
+					break;
+				}
+				default:
+					Position = Index;
+					Fail(TEXT("Invalid escape"));
+					return false;
+				}
+			}
+
+			const FUTF8ToTCHAR Converted(Bytes.GetData(), Bytes.Num());
+			OutString = FString(Converted.Length(), Converted.Get());
+
+			return true;
+		}
+
+		bool ParseNumber(double& OutNumber) {
+			const int64 Start = Position;
+
+			while (Position < Size) {
+				const ANSICHAR Character = Data[Position];
+
+				if ((Character >= '0' && Character <= '9') || Character == '-' || Character == '+' || Character == '.' || Character == 'e' || Character == 'E') {
+					Position++;
+					continue;
+				}
+
+				break;
+			}
+
+			const int64 Length = Position - Start;
+
+			/* Anything longer isn't a number a double could hold anyway */
+			ANSICHAR Buffer[64];
+			if (Length == 0 || Length >= UE_ARRAY_COUNT(Buffer)) {
+				Fail(TEXT("Invalid number"));
+				return false;
+			}
+
+			FMemory::Memcpy(Buffer, Data + Start, Length);
+			Buffer[Length] = '\0';
+
+			OutNumber = FCStringAnsi::Atod(Buffer);
+			return true;
+		}
+
+		TSharedPtr<FJsonValue> ParseNumber() {
+			double Number;
+			if (!ParseNumber(Number)) return nullptr;
+
+			Stats.Values++;
+			return MakeShared<FJsonValueNumber>(Number);
+		}
+
+		TSharedPtr<FJsonSource> Source;
+
+		const ANSICHAR* Data;
+		int64 Size;
+		int64 Position;
+
+		TSharedPtr<FJsonValue> True;
+		TSharedPtr<FJsonValue> False;
+		TSharedPtr<FJsonValue> Null;
+
+		/* Keys converted so far, each distinct key is only converted once per file */
+		TMap<FKeySlice, FString> Keys;
+	};
+}
+
+TSharedPtr<FJsonValue> FMappedJsonReader::ReadFile(const FString& File, FJsonReadStats* OutStats) {
+	const TSharedPtr<FJsonSource> Source = FJsonSource::Open(File);
+
+	if (!Source.IsValid()) {
+		UE_LOG(LogJson, Error, TEXT("Failed to open \"%s\""), *File);
+		return nullptr;
+	}
+
+	return Read(Source, File, OutStats);
+}
+
+TSharedPtr<FJsonValue> FMappedJsonReader::Read(const TSharedPtr<FJsonSource>& Source, const FString& Name, FJsonReadStats* OutStats) {
+	const double StartTime = FPlatformTime::Seconds();
+
+	FUtf8Parser Parser(Source);
+	TSharedPtr<FJsonValue> Value = Parser.Parse();
+
+	if (!Value.IsValid()) {
+		UE_LOG(LogJson, Error, TEXT("Failed to parse \"%s\" at byte %lld: %s"), *Name, Parser.ErrorPosition, *Parser.Error);
+	}
+
+	if (OutStats) {
+		*OutStats = Parser.Stats;
+		OutStats->Seconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	return Value;
+}
+
+bool FMappedJsonReader::ReadFile(const FString& File, TArray<TSharedPtr<FJsonValue>>& OutArray, FJsonReadStats* OutStats) {
+	const TSharedPtr<FJsonValue> Value = ReadFile(File, OutStats);
+
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (!Value.IsValid() || !Value->TryGetArray(Array)) {
+		return false;
+	}
+
+	OutArray = *Array;
+	return true;
+}
@@ -2,16 +2,53 @@
 
 #include "Utilities/RemoteUtilities.h"
 
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Json/JsonBinaryCache.h"
 #include "HttpManager.h"
 #include "HttpModule.h"
+#include "Misc/Compression.h"
 #include "Serialization/JsonSerializer.h"
 
+namespace {
+	/* Set once a binary response couldn't be decoded */
+	TAtomic<bool> bBinaryTransportDisabled(false);
+}
+
 #if ENGINE_UE5
 TSharedPtr<IHttpResponse> FRemoteUtilities::ExecuteRequestSync(TSharedRef<IHttpRequest> HttpRequest, float LoopDelay)
 #else
 TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> FRemoteUtilities::ExecuteRequestSync(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, float LoopDelay)
 #endif
 {
+	JSONASASSET_PHASE_SCOPE(Http);
+
+	const bool bStartedRequest = HttpRequest->ProcessRequest();
+	if (!bStartedRequest)
+	{
+		UE_LOG(LogJson, Error, TEXT("Failed to start HTTP Request."));
+		return nullptr;
+	}
+
+	double LastTime = FPlatformTime::Seconds();
+	while (EHttpRequestStatus::Processing == HttpRequest->GetStatus())
+	{
+		const double AppTime = FPlatformTime::Seconds();
+		FHttpModule::Get().GetHttpManager().Tick(AppTime - LastTime);
+		LastTime = AppTime;
+		FPlatformProcess::Sleep(LoopDelay);
+	}
+
+	return HttpRequest->GetResponse();
+}
+
+#if ENGINE_UE5
+TSharedPtr<IHttpResponse> FRemoteUtilities::ExecuteRequestSync(TSharedRef<IHttpRequest> HttpRequest, TFunctionRef<void()> WhileWaiting, float LoopDelay)
+#else
+TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> FRemoteUtilities::ExecuteRequestSync(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, TFunctionRef<void()> WhileWaiting, float LoopDelay)
+#endif
+{
+	JSONASASSET_PHASE_SCOPE(Http);
+
 	const bool bStartedRequest = HttpRequest->ProcessRequest();
 	if (!bStartedRequest)
 	{
@@ -25,8 +62,61 @@ TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> FRemoteUtilities::ExecuteRequestS
 		const double AppTime = FPlatformTime::Seconds();
 		FHttpModule::Get().GetHttpManager().Tick(AppTime - LastTime);
 		LastTime = AppTime;
+
+		WhileWaiting();
+
 		FPlatformProcess::Sleep(LoopDelay);
 	}
 
 	return HttpRequest->GetResponse();
 }
+
+void FRemoteUtilities::SetTransportHeaders(IHttpRequest& HttpRequest)
+{
+	if (bBinaryTransportDisabled)
+	{
+		HttpRequest.SetHeader(TEXT("Accept"), TEXT("application/json"));
+	}
+	else
+	{
+		HttpRequest.SetHeader(TEXT("Accept"), FString::Printf(TEXT("%s, application/json;q=0.9"), *FJsonBinaryCache::GetWireContentType()));
+	}
+
+	HttpRequest.SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
+}
+
+void FRemoteUtilities::DisableBinaryTransport()
+{
+	if (!bBinaryTransportDisabled.Exchange(true))
+	{
+		UE_LOG(LogJson, Warning, TEXT("Local Fetch sent binary exports this build can't decode (expected version %u), asking for JSON from now on"), FJsonBinaryCache::WireVersion);
+	}
+}
+
+TArray<uint8> FRemoteUtilities::GetDecodedContent(const FHttpResponsePtr& Response)
+{
+	if (!Response.IsValid()) return TArray<uint8>();
+
+	const TArray<uint8>& Content = Response->GetContent();
+
+	/* Some platform HTTP stacks already inflate the body, so check the magic as well as the header */
+	const bool bGzip = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"))
+		&& Content.Num() > 18 && Content[0] == 0x1F && Content[1] == 0x8B;
+
+	if (!bGzip) return Content;
+
+	/* The last four bytes are the uncompressed size */
+	const int32 Num = Content.Num();
+	const int32 UncompressedSize = Content[Num - 4] | Content[Num - 3] << 8 | Content[Num - 2] << 16 | Content[Num - 1] << 24;
+
+	TArray<uint8> Decoded;
+	Decoded.SetNumUninitialized(FMath::Max(0, UncompressedSize));
+
+	if (UncompressedSize <= 0 || !FCompression::UncompressMemory(NAME_Gzip, Decoded.GetData(), UncompressedSize, Content.GetData(), Num))
+	{
+		UE_LOG(LogJson, Error, TEXT("Failed to decompress a gzip response from \"%s\""), *Response->GetURL());
+		return TArray<uint8>();
+	}
+
+	return Decoded;
+}
@@ -12,6 +12,7 @@
 #include "Utilities/Serializers/PropertyUtilities.h"
 #include "UObject/Package.h"
 #include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportProfiler.h"
 
 // ReSharper disable once CppDeclaratorNeverUsed
 DECLARE_LOG_CATEGORY_CLASS(LogObjectSerializer, All, All);
@@ -22,8 +23,9 @@ PRAGMA_DISABLE_OPTIMIZATION
 UObjectSerializer::UObjectSerializer(): ParentAsset(nullptr), PropertySerializer(nullptr) {
 }
 
-void UObjectSerializer::SetupExports(const TArray<TSharedPtr<FJsonValue>>& InObjects) {
-	Exports = InObjects;
+void UObjectSerializer::SetupExports(const FJsonExportView& InObjects) {
+	ExportsStorage = TArray<TSharedPtr<FJsonValue>>(InObjects.begin(), InObjects.Num());
+	Exports = FJsonExportView(ExportsStorage);
 	
 	PropertySerializer->ClearCachedData();
 }
@@ -49,13 +51,13 @@ void UObjectSerializer::SetExportForDeserialization(const TSharedPtr<FJsonObject
 	ExportsToNotDeserialize.Add(Object->GetStringField(TEXT("Name")));
 }
 
-void UObjectSerializer::DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExports) {
+void UObjectSerializer::DeserializeExports(const FJsonExportView InExports) {
 	PropertySerializer->ExportsContainer.Empty();
 	
 	TMap<TSharedPtr<FJsonObject>, UObject*> ExportsMap;
 	int Index = -1;
 	
-	for (TSharedPtr<FJsonValue> Object : InExports) {
+	for (const TSharedPtr<FJsonValue>& Object : InExports) {
 		Index++;
 		
 		TSharedPtr<FJsonObject> ExportObject = Object->AsObject();
@@ -116,7 +118,9 @@ void UObjectSerializer::DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExpo
 	}
 }
 
-void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object) const {
+void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object, const FJsonPropertyFilter& Filter) const {
+	JSONASASSET_PHASE_SCOPE(DeserializeProperties);
+
 	if (Object == nullptr) return;
 
 	const UClass* ObjectClass = Object->GetClass();
@@ -127,7 +131,7 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 		if (!PropertySerializer->ShouldDeserializeProperty(Property)) continue;
 
 		void* PropertyValue = Property->ContainerPtrToValuePtr<void>(Object);
-		const bool HasHandledProperty = PassthroughPropertyHandler(Property, PropertyName, PropertyValue, Properties, PropertySerializer);
+		const bool HasHandledProperty = PassthroughPropertyHandler(Property, PropertyName, PropertyValue, Properties, PropertySerializer, Filter);
 
 		/* Handler Specifically for Animation Blueprint Graph Nodes */
 		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property)) {
@@ -136,12 +140,13 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 				const FAnimNode_Base* AnimNode = static_cast<FAnimNode_Base*>(StructPtr);
 
 				if (AnimNode) {
-					PropertySerializer->DeserializeStruct(StructProperty->Struct, Properties.ToSharedRef(), PropertyValue);
+					/* Struct serializers read the object directly, so they get a filtered copy */
+					PropertySerializer->DeserializeStruct(StructProperty->Struct, Filter.Apply(Properties).ToSharedRef(), PropertyValue);
 				}
 			}
 		}
 		
-		if (Properties->HasField(PropertyName) && !HasHandledProperty && PropertyName != "LODParentPrimitive") {
+		if (Filter.HasField(Properties, PropertyName) && !HasHandledProperty && PropertyName != "LODParentPrimitive") {
 			const TSharedPtr<FJsonValue>& ValueObject = Properties->Values.FindChecked(PropertyName);
 
 			if (Property->ArrayDim == 1 || ValueObject->Type == EJson::Array) {
@@ -156,7 +161,7 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 	 * however I don't think it's possible to do so. as I haven't seen any native
 	 * property that can do this using the data provided in CUE4Parse
 	 */
-	if (Properties->HasField(TEXT("LODData")) && Cast<UStaticMeshComponent>(Object)) {
+	if (Filter.HasField(Properties, TEXT("LODData")) && Cast<UStaticMeshComponent>(Object)) {
 		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Object);
 		if (!StaticMeshComponent) return;
 		
@@ -6,8 +6,12 @@
 #include "Importers/Constructor/Importer.h"
 #include "Utilities/Serializers/ObjectUtilities.h"
 #include "UObject/TextProperty.h"
+#include "Curves/RichCurve.h"
+#include "Utilities/Json/MappedJsonReader.h"
+#include "Utilities/ImportProfiler.h"
 
 /* Struct Serializers */
+#include "Utilities/Serializers/Structs/CoreStructSerializers.h"
 #include "Utilities/Serializers/Structs/DateTimeSerializer.h"
 #include "Utilities/Serializers/Structs/FallbackStructSerializer.h"
 #include "Utilities/Serializers/Structs/TimespanSerializer.h"
@@ -25,9 +29,23 @@ UPropertySerializer::UPropertySerializer() {
 
 	this->StructSerializers.Add(DateTimeStruct, MakeShared<FDateTimeSerializer>());
 	this->StructSerializers.Add(TimespanStruct, MakeShared<FTimespanSerializer>());
+
+	/* Math and core structs, read directly instead of through the fallback reflection walk */
+	this->StructSerializers.Add(TBaseStructure<FVector>::Get(), MakeShared<FVectorSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FVector2D>::Get(), MakeShared<FVector2DSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FRotator>::Get(), MakeShared<FRotatorSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FQuat>::Get(), MakeShared<FQuatSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FTransform>::Get(), MakeShared<FTransformSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FLinearColor>::Get(), MakeShared<FLinearColorSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FColor>::Get(), MakeShared<FColorSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FGuid>::Get(), MakeShared<FGuidSerializer>());
+	this->StructSerializers.Add(TBaseStructure<FIntPoint>::Get(), MakeShared<FIntPointSerializer>());
+	this->StructSerializers.Add(FRichCurveKey::StaticStruct(), MakeShared<FRichCurveKeySerializer>());
 }
 
 void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TSharedRef<FJsonValue>& JsonValue, void* OutValue) {
+	JSONASASSET_PHASE_SCOPE(DeserializeProperty);
+
 	const FMapProperty* MapProperty = CastField<const FMapProperty>(Property);
 	const FSetProperty* SetProperty = CastField<const FSetProperty>(Property);
 	const FArrayProperty* ArrayProperty = CastField<const FArrayProperty>(Property);
@@ -39,6 +57,8 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 	}
 
 	if (MapProperty) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_MapProperty);
+
 		FProperty* KeyProperty = MapProperty->KeyProp;
 		FProperty* ValueProperty = MapProperty->ValueProp;
 		FScriptMapHelper MapHelper(MapProperty, OutValue);
@@ -58,6 +78,8 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 		MapHelper.Rehash();
 
 	} else if (SetProperty) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_SetProperty);
+
 		FProperty* ElementProperty = SetProperty->ElementProp;
 		FScriptSetHelper SetHelper(SetProperty, OutValue);
 		const TArray<TSharedPtr<FJsonValue>>& SetArray = NewJsonValue->AsArray();
@@ -80,11 +102,34 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 		ElementProperty->DestroyValue(TempElementStorage);
 		FMemory::Free(TempElementStorage);
 	} else if (ArrayProperty) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_ArrayProperty);
+
 		FProperty* ElementProperty = ArrayProperty->Inner;
 		FScriptArrayHelper ArrayHelper(ArrayProperty, OutValue);
-		const TArray<TSharedPtr<FJsonValue>>& SetArray = NewJsonValue->AsArray();
 		ArrayHelper.EmptyValues();
 
+		/* Packed number arrays (curve data, vertex colors, pixels, ...) are written without expanding them */
+		const FNumericProperty* NumericElementProperty = CastField<const FNumericProperty>(ElementProperty);
+
+		if (NumericElementProperty && !NumericElementProperty->IsEnum()) {
+			if (const FJsonValuePackedNumbers* Packed = FJsonValuePackedNumbers::Cast(&NewJsonValue.Get())) {
+				const TArrayView<const double> Numbers = Packed->GetNumbers();
+				ArrayHelper.AddValues(Numbers.Num());
+
+				for (int32 i = 0; i < Numbers.Num(); i++) {
+					if (NumericElementProperty->IsFloatingPoint()) {
+						NumericElementProperty->SetFloatingPointPropertyValue(ArrayHelper.GetRawPtr(i), Numbers[i]);
+					} else {
+						NumericElementProperty->SetIntPropertyValue(ArrayHelper.GetRawPtr(i), static_cast<int64>(Numbers[i]));
+					}
+				}
+
+				return;
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>& SetArray = NewJsonValue->AsArray();
+
 		for (int32 i = 0; i < SetArray.Num(); i++) {
 			const TSharedPtr<FJsonValue>& Element = SetArray[i];
 			const uint32 AddedIndex = ArrayHelper.AddValue();
@@ -97,6 +142,8 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 	} else if (CastField<const FInterfaceProperty>(Property)) {
 	}
 	else if (FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property)) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_SoftObjectProperty);
+
 		TSharedPtr<FJsonObject> SoftJsonObjectProperty;
 		FString PathString = "";
 		
@@ -131,6 +178,8 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 		}
 	}
 	else if (const FObjectPropertyBase* ObjectProperty = CastField<const FObjectPropertyBase>(Property)) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_ObjectProperty);
+
 		/* Need to serialize full UObject for object property */
 		TObjectPtr<UObject> Object = nullptr;
 
@@ -169,7 +218,7 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 
 			if (Object != nullptr) {
 				/* Get the export */
-				if (TSharedPtr<FJsonObject> Export = GetExport(JsonValueAsObject.Get(), ObjectSerializer->Exports)) {
+				if (TSharedPtr<FJsonObject> Export = GetExport(JsonValueAsObject.Get(), ObjectSerializer->GetExports())) {
 					if (Export->HasField(TEXT("Properties"))) {
 						TSharedPtr<FJsonObject> Properties = Export->GetObjectField(TEXT("Properties"));
 
@@ -217,6 +266,8 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 		}
 	}
 	else if (const FStructProperty* StructProperty = CastField<const FStructProperty>(Property)) {
+		TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_StructProperty);
+
 		if (StructProperty->Struct == FGameplayTag::StaticStruct()) {
 			FGameplayTag* GameplayTagStr = static_cast<FGameplayTag*>(OutValue);
 			FGameplayTag NewTag = FGameplayTag::RequestGameplayTag(FName(*NewJsonValue->AsObject()->GetStringField(TEXT("TagName"))), false);
@@ -265,18 +316,15 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 			}
 		}
 		
-		/* JSON for FGuids are FStrings */
+		/* JSON for FGuids are FStrings, parsed straight into the struct */
 		FString OutString;
-		
-		if (JsonValue->TryGetString(OutString)) {
-			FGuid GUID = FGuid(OutString); /* Create GUID from String */
 
-			TSharedRef<FJsonObject> SharedObject = MakeShareable(new FJsonObject());
-			SharedObject->SetNumberField(TEXT("A"), GUID.A); SharedObject->SetNumberField(TEXT("B"), GUID.B);
-			SharedObject->SetNumberField(TEXT("C"), GUID.C); SharedObject->SetNumberField(TEXT("D"), GUID.D);
+		if (JsonValue->TryGetString(OutString)) {
+			if (StructProperty->Struct == TBaseStructure<FGuid>::Get()) {
+				*static_cast<FGuid*>(OutValue) = FGuid(OutString);
+			}
 
-			const TSharedRef<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(SharedObject));
-			NewJsonValue = NewValue;
+			return;
 		}
 
 		/* To serialize struct, we need its type and value pointer, because struct value doesn't contain type information */
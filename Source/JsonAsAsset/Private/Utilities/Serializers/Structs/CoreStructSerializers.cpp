@@ -0,0 +1,182 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Serializers/Structs/CoreStructSerializers.h"
+#include "Curves/RichCurve.h"
+
+namespace {
+	/* Keys are built once, a TEXT() literal would allocate an FString on every lookup */
+	const FString KeyX(TEXT("X"));
+	const FString KeyY(TEXT("Y"));
+	const FString KeyZ(TEXT("Z"));
+	const FString KeyW(TEXT("W"));
+	const FString KeyPitch(TEXT("Pitch"));
+	const FString KeyYaw(TEXT("Yaw"));
+	const FString KeyRoll(TEXT("Roll"));
+	const FString KeyRotation(TEXT("Rotation"));
+	const FString KeyTranslation(TEXT("Translation"));
+	const FString KeyScale3D(TEXT("Scale3D"));
+	const FString KeyR(TEXT("R"));
+	const FString KeyG(TEXT("G"));
+	const FString KeyB(TEXT("B"));
+	const FString KeyA(TEXT("A"));
+	const FString KeyC(TEXT("C"));
+	const FString KeyD(TEXT("D"));
+	const FString KeyInterpMode(TEXT("InterpMode"));
+	const FString KeyTangentMode(TEXT("TangentMode"));
+	const FString KeyTangentWeightMode(TEXT("TangentWeightMode"));
+	const FString KeyTime(TEXT("Time"));
+	const FString KeyValue(TEXT("Value"));
+	const FString KeyArriveTangent(TEXT("ArriveTangent"));
+	const FString KeyArriveTangentWeight(TEXT("ArriveTangentWeight"));
+	const FString KeyLeaveTangent(TEXT("LeaveTangent"));
+	const FString KeyLeaveTangentWeight(TEXT("LeaveTangentWeight"));
+
+	template <typename T>
+	void ReadNumber(const FJsonObject* Json, const FString& Key, T& Out) {
+		const TSharedPtr<FJsonValue>* Value = Json->Values.Find(Key);
+		if (Value == nullptr || !Value->IsValid()) return;
+
+		double Number;
+		if ((*Value)->TryGetNumber(Number)) {
+			Out = static_cast<T>(Number);
+		}
+	}
+
+	template <typename TEnum>
+	void ReadEnum(const FJsonObject* Json, const FString& Key, TEnumAsByte<TEnum>& Out) {
+		const TSharedPtr<FJsonValue>* Value = Json->Values.Find(Key);
+		if (Value == nullptr || !Value->IsValid()) return;
+
+		/* Readable enum names, same as the byte property path */
+		if ((*Value)->Type == EJson::String) {
+			const int64 EnumerationValue = StaticEnum<TEnum>()->GetValueByNameString((*Value)->AsString());
+
+			if (EnumerationValue != INDEX_NONE) {
+				Out = static_cast<TEnum>(EnumerationValue);
+			}
+
+			return;
+		}
+
+		double Number;
+		if ((*Value)->TryGetNumber(Number)) {
+			Out = static_cast<TEnum>(static_cast<int64>(Number));
+		}
+	}
+
+	const FJsonObject* ReadObject(const FJsonObject* Json, const FString& Key) {
+		const TSharedPtr<FJsonValue>* Value = Json->Values.Find(Key);
+		if (Value == nullptr || !Value->IsValid() || (*Value)->Type != EJson::Object) return nullptr;
+
+		return (*Value)->AsObject().Get();
+	}
+
+	void ReadVector(const FJsonObject* Json, FVector& Vector) {
+		ReadNumber(Json, KeyX, Vector.X);
+		ReadNumber(Json, KeyY, Vector.Y);
+		ReadNumber(Json, KeyZ, Vector.Z);
+	}
+
+	void ReadQuat(const FJsonObject* Json, FQuat& Quat) {
+		ReadNumber(Json, KeyX, Quat.X);
+		ReadNumber(Json, KeyY, Quat.Y);
+		ReadNumber(Json, KeyZ, Quat.Z);
+		ReadNumber(Json, KeyW, Quat.W);
+	}
+}
+
+void FVectorSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	ReadVector(JsonValue.Get(), *static_cast<FVector*>(StructData));
+}
+
+void FVector2DSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FVector2D* Vector = static_cast<FVector2D*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyX, Vector->X);
+	ReadNumber(JsonValue.Get(), KeyY, Vector->Y);
+}
+
+void FRotatorSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FRotator* Rotator = static_cast<FRotator*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyPitch, Rotator->Pitch);
+	ReadNumber(JsonValue.Get(), KeyYaw, Rotator->Yaw);
+	ReadNumber(JsonValue.Get(), KeyRoll, Rotator->Roll);
+}
+
+void FQuatSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	ReadQuat(JsonValue.Get(), *static_cast<FQuat*>(StructData));
+}
+
+void FTransformSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FTransform* Transform = static_cast<FTransform*>(StructData);
+
+	/* FTransform may be vectorized, so go through the setters */
+	if (const FJsonObject* RotationObject = ReadObject(JsonValue.Get(), KeyRotation)) {
+		FQuat Rotation = Transform->GetRotation();
+		ReadQuat(RotationObject, Rotation);
+		Transform->SetRotation(Rotation);
+	}
+
+	if (const FJsonObject* TranslationObject = ReadObject(JsonValue.Get(), KeyTranslation)) {
+		FVector Translation = Transform->GetTranslation();
+		ReadVector(TranslationObject, Translation);
+		Transform->SetTranslation(Translation);
+	}
+
+	if (const FJsonObject* ScaleObject = ReadObject(JsonValue.Get(), KeyScale3D)) {
+		FVector Scale = Transform->GetScale3D();
+		ReadVector(ScaleObject, Scale);
+		Transform->SetScale3D(Scale);
+	}
+}
+
+void FLinearColorSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FLinearColor* Color = static_cast<FLinearColor*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyR, Color->R);
+	ReadNumber(JsonValue.Get(), KeyG, Color->G);
+	ReadNumber(JsonValue.Get(), KeyB, Color->B);
+	ReadNumber(JsonValue.Get(), KeyA, Color->A);
+}
+
+void FColorSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FColor* Color = static_cast<FColor*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyR, Color->R);
+	ReadNumber(JsonValue.Get(), KeyG, Color->G);
+	ReadNumber(JsonValue.Get(), KeyB, Color->B);
+	ReadNumber(JsonValue.Get(), KeyA, Color->A);
+}
+
+void FGuidSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FGuid* Guid = static_cast<FGuid*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyA, Guid->A);
+	ReadNumber(JsonValue.Get(), KeyB, Guid->B);
+	ReadNumber(JsonValue.Get(), KeyC, Guid->C);
+	ReadNumber(JsonValue.Get(), KeyD, Guid->D);
+}
+
+void FIntPointSerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FIntPoint* Point = static_cast<FIntPoint*>(StructData);
+
+	ReadNumber(JsonValue.Get(), KeyX, Point->X);
+	ReadNumber(JsonValue.Get(), KeyY, Point->Y);
+}
+
+void FRichCurveKeySerializer::Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) {
+	FRichCurveKey* Key = static_cast<FRichCurveKey*>(StructData);
+	const FJsonObject* Json = JsonValue.Get();
+
+	ReadEnum(Json, KeyInterpMode, Key->InterpMode);
+	ReadEnum(Json, KeyTangentMode, Key->TangentMode);
+	ReadEnum(Json, KeyTangentWeightMode, Key->TangentWeightMode);
+
+	ReadNumber(Json, KeyTime, Key->Time);
+	ReadNumber(Json, KeyValue, Key->Value);
+	ReadNumber(Json, KeyArriveTangent, Key->ArriveTangent);
+	ReadNumber(Json, KeyArriveTangentWeight, Key->ArriveTangentWeight);
+	ReadNumber(Json, KeyLeaveTangent, Key->LeaveTangent);
+	ReadNumber(Json, KeyLeaveTangentWeight, Key->LeaveTangentWeight);
+}
@@ -3,6 +3,7 @@
 #include "Utilities/Textures/TextureCreatorUtilities.h"
 
 #include "detex.h"
+#include "Async/ParallelFor.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/TextureCube.h"
 #include "Engine/VolumeTexture.h"
@@ -10,10 +11,247 @@
 #include "nvimage/DirectDrawSurface.h"
 #include "nvimage/Image.h"
 #include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportProfiler.h"
 #include "Utilities/JsonUtilities.h"
+#include "Settings/JsonAsAssetSettings.h"
 #include "Utilities/Textures/TextureDecode/TextureNVTT.h"
+#include "Utilities/Textures/TextureDecode/TextureSwizzle.h"
+#include "Utilities/Textures/TexturePreview.h"
 
 bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const {
+	const int32 NumMips = GetNumImportedMips(Properties, Data.Num());
+
+	if (NumMips <= 1) {
+		return CreateTexture2D(OutTexture2D, [&Data](FTextureRowDecoder& Decoder) {
+			Decoder.Decode(Data.GetData(), Data.Num());
+
+			return Decoder.IsComplete();
+		}, Properties);
+	}
+
+	UTexture2D* Texture2D = NewTexture2D(Properties, NumMips);
+
+#if ENGINE_UE5
+	DecodeSourceMips(Texture2D, Texture2D->GetPlatformData()->PixelFormat, Data.GetData());
+#else
+	DecodeSourceMips(Texture2D, Texture2D->PlatformData->PixelFormat, Data.GetData());
+#endif
+
+	return FinishTexture2D(Texture2D, true, OutTexture2D);
+}
+
+bool FTextureCreatorUtilities::CreatePreviewTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const {
+	const int32 NumSourceMips = GetNumImportedMips(Properties, Data.Num());
+	UTexture2D* Texture2D = NewTexture2D(Properties, NumSourceMips, false);
+
+#if ENGINE_UE5
+	FTexturePlatformData* PlatformData = Texture2D->GetPlatformData();
+#else
+	FTexturePlatformData* PlatformData = Texture2D->PlatformData;
+#endif
+
+	const EPixelFormat PixelFormat = PlatformData->PixelFormat;
+	const int32 NumMips = GetNumPayloadMips(Properties, Data.Num());
+
+	/* Not even the top mip arrived */
+	if (Data.Num() < FTextureRowDecoder(PixelFormat, PlatformData->SizeX, PlatformData->SizeY, nullptr).GetPayloadSize()) {
+		return FinishTexture2D(Texture2D, false, OutTexture2D);
+	}
+
+	const uint8* Payload = Data.GetData();
+
+	/* The payload is laid out like the platform data's mips, one after the other */
+	for (int32 MipIndex = 0; MipIndex < NumMips; MipIndex++) {
+		FTexture2DMipMap* Mip = new FTexture2DMipMap();
+		PlatformData->Mips.Add(Mip);
+
+		Mip->SizeX = FMath::Max(PlatformData->SizeX >> MipIndex, 1);
+		Mip->SizeY = FMath::Max(PlatformData->SizeY >> MipIndex, 1);
+		Mip->SizeZ = 1;
+
+		const int64 MipBytes = FTextureRowDecoder(PixelFormat, Mip->SizeX, Mip->SizeY, nullptr).GetPayloadSize();
+
+		Mip->BulkData.Lock(LOCK_READ_WRITE);
+		FMemory::Memcpy(Mip->BulkData.Realloc(MipBytes), Payload, MipBytes);
+		Mip->BulkData.Unlock();
+
+		Payload += MipBytes;
+	}
+
+	FTexturePreviewSource Source;
+	Source.PixelFormat = PixelFormat;
+	Source.SourceFormat = GetSourceFormat(Texture2D);
+	Source.NumSourceMips = NumSourceMips;
+	Source.bNeverStream = Texture2D->NeverStream;
+
+	/* The platform data holds it now, the source is decoded from there */
+	Data.Empty();
+
+	/* The mips only live in memory, there's nothing to stream them from */
+	Texture2D->NeverStream = true;
+
+	FTexturePreview::Add(Texture2D, MoveTemp(Source));
+
+	return FinishTexture2D(Texture2D, true, OutTexture2D);
+}
+
+bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, const TFunctionRef<bool(FTextureRowDecoder& Decoder)> ReadData, const TSharedPtr<FJsonObject>& Properties) const {
+	UTexture2D* Texture2D = NewTexture2D(Properties, 1);
+
+#if ENGINE_UE5
+	const EPixelFormat PixelFormat = Texture2D->GetPlatformData()->PixelFormat;
+#else
+	const EPixelFormat PixelFormat = Texture2D->PlatformData->PixelFormat;
+#endif
+
+	const int SizeX = Texture2D->Source.GetSizeX();
+	const int SizeY = Texture2D->Source.GetSizeY();
+
+	const int64 SourceSize = Texture2D->Source.CalcMipSize(0);
+	const int64 DecodedSize = FTextureRowDecoder::GetDecodedSize(PixelFormat, SizeX, SizeY);
+
+	uint8_t* Dest = Texture2D->Source.LockMip(0);
+
+	/* Decoded straight into the source, unless the decoded layout doesn't match it */
+	TArray64<uint8> Staging;
+	if (DecodedSize != SourceSize) {
+		Staging.SetNumZeroed(DecodedSize);
+	}
+
+	FTextureRowDecoder Decoder(PixelFormat, SizeX, SizeY, Staging.Num() > 0 ? Staging.GetData() : Dest);
+	const bool bReadData = ReadData(Decoder);
+
+	if (Staging.Num() > 0) {
+		FMemory::Memcpy(Dest, Staging.GetData(), FMath::Min(SourceSize, Staging.Num()));
+	}
+
+	Texture2D->Source.UnlockMip(0);
+
+	return FinishTexture2D(Texture2D, bReadData, OutTexture2D);
+}
+
+int32 FTextureCreatorUtilities::GetNumImportedMips(const TSharedPtr<FJsonObject>& Properties, const int64 DataSize) {
+	if (!GetDefault<UJsonAsAssetSettings>()->AssetSettings.TextureImportSettings.bImportAllMips) return 1;
+
+	return GetNumPayloadMips(Properties, DataSize);
+}
+
+int32 FTextureCreatorUtilities::GetNumPayloadMips(const TSharedPtr<FJsonObject>& Properties, const int64 DataSize) {
+	const TArray<TSharedPtr<FJsonValue>>* Mips;
+	if (!Properties->TryGetArrayField(TEXT("Mips"), Mips)) return 1;
+
+	FString PixelFormatName;
+	if (!Properties->TryGetStringField(TEXT("PixelFormat"), PixelFormatName)) return 1;
+
+	const int64 PixelFormat = UTexture::GetPixelFormatEnum()->GetValueByNameString(PixelFormatName);
+	if (PixelFormat == INDEX_NONE) return 1;
+
+	const int32 SizeX = Properties->GetNumberField(TEXT("SizeX"));
+	const int32 SizeY = Properties->GetNumberField(TEXT("SizeY"));
+
+	int32 NumMips = 0;
+	int64 PayloadSize = 0;
+
+	/* The mips that halve from the top one, as far as the data goes. A cooked export may have dropped some. */
+	for (const TSharedPtr<FJsonValue>& Value : *Mips) {
+		const TSharedPtr<FJsonObject> Mip = Value->AsObject();
+		if (!Mip.IsValid()) break;
+
+		const int32 MipSizeX = FMath::Max(SizeX >> NumMips, 1);
+		const int32 MipSizeY = FMath::Max(SizeY >> NumMips, 1);
+
+		if (Mip->GetNumberField(TEXT("SizeX")) != MipSizeX || Mip->GetNumberField(TEXT("SizeY")) != MipSizeY) break;
+
+		PayloadSize += FTextureRowDecoder(static_cast<EPixelFormat>(PixelFormat), MipSizeX, MipSizeY, nullptr).GetPayloadSize();
+		if (PayloadSize > DataSize) break;
+
+		NumMips++;
+	}
+
+	return FMath::Max(NumMips, 1);
+}
+
+void FTextureCreatorUtilities::DecodeSourceMips(UTexture2D* Texture2D, const EPixelFormat PixelFormat, const uint8* Payload) {
+	TArray<const uint8*, TInlineAllocator<MAX_TEXTURE_MIP_COUNT>> MipPayloads;
+
+	for (int32 Mip = 0; Mip < Texture2D->Source.GetNumMips(); Mip++) {
+		MipPayloads.Add(Payload);
+
+		Payload += FTextureRowDecoder(PixelFormat, FMath::Max(Texture2D->Source.GetSizeX() >> Mip, 1), FMath::Max(Texture2D->Source.GetSizeY() >> Mip, 1), nullptr).GetPayloadSize();
+	}
+
+	DecodeSourceMips(Texture2D, PixelFormat, MipPayloads);
+}
+
+void FTextureCreatorUtilities::DecodeSourceMips(UTexture2D* Texture2D, const EPixelFormat PixelFormat, const TArrayView<const uint8* const> MipPayloads) {
+	const FPixelFormatInfo& Info = GPixelFormats[PixelFormat];
+	const int32 BlockSizeX = FMath::Max(Info.BlockSizeX, 1);
+	const int32 BlockSizeY = FMath::Max(Info.BlockSizeY, 1);
+
+	/* A run of block rows of one mip, decoded by one task */
+	struct FDecodeTask {
+		const uint8* Payload;
+		uint8* Dest;
+		int32 SizeX;
+		int32 SizeY;
+	};
+
+	constexpr int32 BlockRowsPerTask = 64;
+
+	TArray<FDecodeTask> Tasks;
+
+	const int32 NumMips = Texture2D->Source.GetNumMips();
+
+	TArray<uint8*> Locked;
+	TArray<TArray64<uint8>> Staging;
+	Staging.SetNum(NumMips);
+
+	for (int32 Mip = 0; Mip < NumMips; Mip++) {
+		const int32 MipSizeX = FMath::Max(Texture2D->Source.GetSizeX() >> Mip, 1);
+		const int32 MipSizeY = FMath::Max(Texture2D->Source.GetSizeY() >> Mip, 1);
+
+		const int64 BlockRowBytes = static_cast<int64>(FMath::DivideAndRoundUp(MipSizeX, BlockSizeX)) * Info.BlockBytes;
+		const int64 PixelRowBytes = FTextureRowDecoder::GetDecodedSize(PixelFormat, MipSizeX, 1);
+
+		/* Same as the top mip, decoded straight into the source unless the layouts differ */
+		uint8* Dest = Locked.Add_GetRef(Texture2D->Source.LockMip(Mip));
+
+		if (FTextureRowDecoder::GetDecodedSize(PixelFormat, MipSizeX, MipSizeY) != Texture2D->Source.CalcMipSize(Mip)) {
+			Staging[Mip].SetNumZeroed(FTextureRowDecoder::GetDecodedSize(PixelFormat, MipSizeX, MipSizeY));
+			Dest = Staging[Mip].GetData();
+		}
+
+		const int32 NumBlockRows = FMath::DivideAndRoundUp(MipSizeY, BlockSizeY);
+
+		for (int32 BlockRow = 0; BlockRow < NumBlockRows; BlockRow += BlockRowsPerTask) {
+			const int32 FirstPixelRow = BlockRow * BlockSizeY;
+
+			Tasks.Add({
+				MipPayloads[Mip] + BlockRow * BlockRowBytes,
+				Dest + FirstPixelRow * PixelRowBytes,
+				MipSizeX,
+				FMath::Min((BlockRow + BlockRowsPerTask) * BlockSizeY, MipSizeY) - FirstPixelRow
+			});
+		}
+	}
+
+	ParallelFor(Tasks.Num(), [&Tasks, PixelFormat](const int32 Index) {
+		const FDecodeTask& Task = Tasks[Index];
+
+		FTextureRowDecoder Decoder(PixelFormat, Task.SizeX, Task.SizeY, Task.Dest);
+		Decoder.Decode(Task.Payload, Decoder.GetPayloadSize());
+	});
+
+	for (int32 Mip = NumMips - 1; Mip >= 0; Mip--) {
+		if (Staging[Mip].Num() > 0) {
+			FMemory::Memcpy(Locked[Mip], Staging[Mip].GetData(), FMath::Min(Texture2D->Source.CalcMipSize(Mip), Staging[Mip].Num()));
+		}
+
+		Texture2D->Source.UnlockMip(Mip);
+	}
+}
+
+UTexture2D* FTextureCreatorUtilities::NewTexture2D(const TSharedPtr<FJsonObject>& Properties, const int32 NumMips, const bool bInitSource) const {
 	const TSharedPtr<FJsonObject> SubObjectProperties = Properties->GetObjectField(TEXT("Properties"));
 
 	UTexture2D* Texture2D = NewObject<UTexture2D>(OutermostPkg, UTexture2D::StaticClass(), *FileName, RF_Standalone | RF_Public);
@@ -34,7 +272,6 @@ bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<u
 
 	const int SizeX = Properties->GetNumberField(TEXT("SizeX"));
 	const int SizeY = Properties->GetNumberField(TEXT("SizeY"));
-	constexpr int SizeZ = 1; /* Tex2D doesn't have depth */
 
 	const TArray<TSharedPtr<FJsonValue>>* TextureMipsPtr;
 	Properties->TryGetArrayField(TEXT("Mips"), TextureMipsPtr);
@@ -45,24 +282,48 @@ bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<u
 		}
 	}
 
+	/* Authored mips are kept as they are, the build doesn't generate them again */
+	if (NumMips > 1) {
+		Texture2D->MipGenSettings = TextureMipGenSettings::TMGS_LeaveExistingMips;
+	}
+
 	FString PixelFormat;
 	if (Properties->TryGetStringField(TEXT("PixelFormat"), PixelFormat)) {
 		PlatformData->PixelFormat = static_cast<EPixelFormat>(Texture2D->GetPixelFormatEnum()->GetValueByNameString(PixelFormat));
 	}
 
-	int Size = SizeX * SizeY * (PlatformData->PixelFormat == PF_BC6H ? 16 : 4);
-	if (PlatformData->PixelFormat == PF_B8G8R8A8 || PlatformData->PixelFormat == PF_FloatRGBA || PlatformData->PixelFormat == PF_G16) Size = Data.Num();
-	uint8* DecompressedData = static_cast<uint8*>(FMemory::Malloc(Size));
+	if (bInitSource) {
+		Texture2D->Source.Init(SizeX, SizeY, 1, NumMips, GetSourceFormat(Texture2D));
+	}
 
-	GetDecompressedTextureData(Data.GetData(), DecompressedData, SizeX, SizeY, SizeZ, Size, PlatformData->PixelFormat);
+	return Texture2D;
+}
+
+ETextureSourceFormat FTextureCreatorUtilities::GetSourceFormat(UTexture2D* Texture2D) {
+#if ENGINE_UE5
+	const EPixelFormat PixelFormat = Texture2D->GetPlatformData()->PixelFormat;
+#else
+	const EPixelFormat PixelFormat = Texture2D->PlatformData->PixelFormat;
+#endif
 
 	ETextureSourceFormat Format = TSF_BGRA8;
-	if (Texture2D->CompressionSettings == TC_HDR) Format = TSF_RGBA16F;
-	if (PlatformData->PixelFormat == PF_G16) Format = TSF_G16;
-	Texture2D->Source.Init(SizeX, SizeY, 1, 1, Format);
-	uint8_t* Dest = Texture2D->Source.LockMip(0);
-	FMemory::Memcpy(Dest, DecompressedData, Size);
-	Texture2D->Source.UnlockMip(0);
+	if (Texture2D->CompressionSettings == TC_HDR || PixelFormat == PF_BC6H) Format = TSF_RGBA16F;
+	if (PixelFormat == PF_G16 || PixelFormat == PF_ETC2_R11_EAC) Format = TSF_G16;
+
+	/* Single channel formats keep a single channel source, a quarter of BGRA8 */
+	if (PixelFormat == PF_G8 || PixelFormat == PF_BC4) Format = TSF_G8;
+
+	return Format;
+}
+
+bool FTextureCreatorUtilities::FinishTexture2D(UTexture2D* Texture2D, const bool bReadData, UTexture*& OutTexture2D) const {
+	/* Download failed half way, move the texture out of the way of a retry */
+	if (!bReadData) {
+		Texture2D->ClearFlags(RF_Standalone | RF_Public);
+		Texture2D->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+
+		return false;
+	}
 
 	Texture2D->UpdateResource();
 
@@ -250,78 +511,101 @@ bool FTextureCreatorUtilities::DeserializeTexture2D(UTexture2D* InTexture2D, con
 bool FTextureCreatorUtilities::DeserializeTexture(UTexture* Texture, const TSharedPtr<FJsonObject>& Properties) const {
 	if (Texture == nullptr) return false;
 
-	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(Properties,
-	{
+	GetObjectSerializer()->DeserializeObjectProperties(Properties, Texture, FJsonPropertyFilter::Remove({
 		"ImportedSize",
 		"LODBias"
-	}), Texture);
+	}));
 	
 	return false;
 }
 
+namespace {
+	/* Decodes whole 4x4 blocks, partial ones at the right and bottom edges are cropped */
+	void DecompressDetex(uint8* Data, uint8* OutData, const int SizeX, const int SizeY, const uint32_t TextureFormat, const uint32_t PixelFormat) {
+		detexTexture Texture;
+		Texture.data = Data;
+		Texture.format = TextureFormat;
+		Texture.width = SizeX;
+		Texture.height = SizeY;
+		Texture.width_in_blocks = FMath::DivideAndRoundUp(SizeX, 4);
+		Texture.height_in_blocks = FMath::DivideAndRoundUp(SizeY, 4);
+
+		detexDecompressTextureLinear(&Texture, OutData, PixelFormat);
+	}
+}
+
 void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format) {
+	JSONASASSET_PHASE_SCOPE(TextureDecode);
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(GPixelFormats[Format].Name);
+
 	/* NOTE: Not all formats are supported, feel free to add if needed. Formats may need other dependencies. */
 	switch (Format) {
 		case PF_BC7: {
-			detexTexture Texture;
-			Texture.data = Data;
-			Texture.format = DETEX_TEXTURE_FORMAT_BPTC;
-			Texture.width = SizeX;
-			Texture.height = SizeY;
-			Texture.width_in_blocks = SizeX / 4;
-			Texture.height_in_blocks = SizeY / 4;
-
-			detexDecompressTextureLinear(&Texture, OutData, DETEX_PIXEL_FORMAT_BGRA8);
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_BPTC, DETEX_PIXEL_FORMAT_BGRA8);
 		}
 		break;
 
+		/* HDR, decoded to half floats as they are stored, to a TSF_RGBA16F source */
 		case PF_BC6H: {
-			detexTexture Texture;
-			Texture.data = Data;
-			Texture.format = DETEX_TEXTURE_FORMAT_BPTC_FLOAT;
-			Texture.width = SizeX;
-			Texture.height = SizeY;
-			Texture.width_in_blocks = SizeX / 4;
-			Texture.height_in_blocks = SizeY / 4;
-
-			detexDecompressTextureLinear(&Texture, OutData, DETEX_PIXEL_FORMAT_BGRA8);
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_BPTC_FLOAT, DETEX_PIXEL_FORMAT_FLOAT_RGBX16);
+			SetOpaqueAlphaRGBA16F(OutData, static_cast<int64>(SizeX) * SizeY);
 		}
 		break;
 
 		case PF_DXT5: {
-			detexTexture Texture;
-			{
-				Texture.data = Data;
-				Texture.format = DETEX_TEXTURE_FORMAT_BC3;
-				Texture.width = SizeX;
-				Texture.height = SizeY;
-				Texture.width_in_blocks = SizeX / 4;
-				Texture.height_in_blocks = SizeY / 4;
-			}
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_BC3, DETEX_PIXEL_FORMAT_BGRA8);
+		}
+		break;
 
-			detexDecompressTextureLinear(&Texture, OutData, DETEX_PIXEL_FORMAT_BGRA8);
+		/* Single channel, to a TSF_G8 source */
+		case PF_BC4: {
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_RGTC1, DETEX_PIXEL_FORMAT_R8);
 		}
 		break;
 
-		/* Gray/Grey, not Green, typically actually uses a red format with replication of R to RGB*/
-		case PF_G8: {
-			const uint8* s = Data;
-			uint8* d = OutData;
-
-			for (int i = 0; i < SizeX * SizeY; i++) {
-				const uint8 b = *s++;
-				*d++ = b;
-				*d++ = b;
-				*d++ = b;
-				*d++ = 255;
-			}
+		/*
+		 * Normal maps, there's no two channel source format so Z is rebuilt into BGRA8.
+		 * XY is decoded into the second half of the output and expanded in place.
+		 */
+		case PF_BC5: {
+			const int64 NumPixels = static_cast<int64>(SizeX) * SizeY;
+			uint8* XY = OutData + NumPixels * 2;
+
+			DecompressDetex(Data, XY, SizeX, SizeY, DETEX_TEXTURE_FORMAT_RGTC2, DETEX_PIXEL_FORMAT_RG8);
+			ExpandNormalRG8ToBGRA8(XY, OutData, NumPixels);
+		}
+		break;
+
+		/* Mobile, ETC2 is a superset of ETC1 and decodes valid ETC1 blocks the same */
+		case PF_ETC1:
+		case PF_ETC2_RGB: {
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_ETC2, DETEX_PIXEL_FORMAT_BGRA8);
+		}
+		break;
+
+		case PF_ETC2_RGBA: {
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_ETC2_EAC, DETEX_PIXEL_FORMAT_BGRA8);
+		}
+		break;
+
+		/* Single channel with 11 bits, to a TSF_G16 source */
+		case PF_ETC2_R11_EAC: {
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_EAC_R11, DETEX_PIXEL_FORMAT_R16);
+		}
+		break;
+
+		/* Normal maps like BC5, RG16 takes as many bytes as BGRA8 so it's expanded in place */
+		case PF_ETC2_RG11_EAC: {
+			DecompressDetex(Data, OutData, SizeX, SizeY, DETEX_TEXTURE_FORMAT_EAC_RG11, DETEX_PIXEL_FORMAT_RG16);
+			ExpandNormalRG16ToBGRA8(OutData, static_cast<int64>(SizeX) * SizeY);
 		}
 		break;
 
 		/*
 		 * FloatRGBA: 16F
-		 * G16: Gray/Grey like G8
+		 * G8/G16: Gray/Grey, not Green, copied to a TSF_G8/TSF_G16 source
 		*/
+		case PF_G8:
 		case PF_B8G8R8A8:
 		case PF_FloatRGBA:
 		case PF_G16: {
@@ -335,12 +619,6 @@ void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& O
 
 			uint FourCC;
 			switch (Format) {
-			case PF_BC4:
-				FourCC = FOURCC_ATI1;
-				break;
-			case PF_BC5:
-				FourCC = FOURCC_ATI2;
-				break;
 			case PF_DXT1:
 				FourCC = FOURCC_DXT1;
 				break;
@@ -354,7 +632,6 @@ void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& O
 			Header.setWidth(SizeX);
 			Header.setHeight(SizeY);
 			Header.setDepth(SizeZ);
-			Header.setNormalFlag(Format == PF_BC5);
 			DecodeDDS(Data, SizeX, SizeY, SizeZ, Header, Image);
 
 			FMemory::Memcpy(OutData, Image.pixels(), TotalSize);
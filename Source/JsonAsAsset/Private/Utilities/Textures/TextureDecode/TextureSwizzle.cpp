@@ -0,0 +1,111 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "TextureSwizzle.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define JSONASASSET_SWIZZLE_SSE2 1
+#else
+#define JSONASASSET_SWIZZLE_SSE2 0
+#endif
+
+namespace {
+	/* Same arithmetic as NVTT's buildNormal, so both paths give the same bytes */
+	FORCEINLINE uint32 BuildNormal(const uint8 X, const uint8 Y) {
+		const float NX = 2 * (X / 255.0f) - 1;
+		const float NY = 2 * (Y / 255.0f) - 1;
+		const float NZ = FMath::Sqrt(FMath::Max(0.0f, 1 - NX * NX - NY * NY));
+		const uint32 Z = FMath::Clamp(static_cast<int32>(255.0f * (NZ + 1) / 2.0f), 0, 255);
+
+		return Z | (static_cast<uint32>(Y) << 8) | (static_cast<uint32>(X) << 16) | 0xFF000000u;
+	}
+
+#if JSONASASSET_SWIZZLE_SSE2
+	/* BuildNormal on four pixels, X and Y are one byte per 32-bit lane */
+	FORCEINLINE __m128i BuildNormals(const __m128i X, const __m128i Y) {
+		const __m128 Scale = _mm_set1_ps(255.0f);
+		const __m128 One = _mm_set1_ps(1.0f);
+		const __m128 Two = _mm_set1_ps(2.0f);
+
+		const __m128 NX = _mm_sub_ps(_mm_mul_ps(Two, _mm_div_ps(_mm_cvtepi32_ps(X), Scale)), One);
+		const __m128 NY = _mm_sub_ps(_mm_mul_ps(Two, _mm_div_ps(_mm_cvtepi32_ps(Y), Scale)), One);
+		const __m128 NZ = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_sub_ps(One, _mm_mul_ps(NX, NX)), _mm_mul_ps(NY, NY))));
+
+		/* NZ is within [0, 1], Z can't leave [127, 255] */
+		const __m128i Z = _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(Scale, _mm_add_ps(NZ, One)), Two));
+
+		/* B = Z, G = Y, R = X, A = 255 */
+		return _mm_or_si128(_mm_or_si128(Z, _mm_slli_epi32(Y, 8)), _mm_or_si128(_mm_slli_epi32(X, 16), _mm_set1_epi32(static_cast<int32>(0xFF000000u))));
+	}
+#endif
+}
+
+void ExpandNormalRG8ToBGRA8(const uint8* Source, uint8* Dest, const int64 NumPixels) {
+	int64 Pixel = 0;
+
+#if JSONASASSET_SWIZZLE_SSE2
+	const __m128i ByteMask = _mm_set1_epi32(0xFF);
+
+	for (; Pixel + 4 <= NumPixels; Pixel += 4) {
+		/* XY pairs widened to one 32-bit lane per pixel: X | Y << 8 */
+		const __m128i Pairs = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Source + Pixel * 2)), _mm_setzero_si128());
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Pixel * 4), BuildNormals(_mm_and_si128(Pairs, ByteMask), _mm_srli_epi32(Pairs, 8)));
+	}
+#endif
+
+	for (; Pixel < NumPixels; Pixel++) {
+		const uint32 Value = BuildNormal(Source[Pixel * 2], Source[Pixel * 2 + 1]);
+		FMemory::Memcpy(Dest + Pixel * 4, &Value, 4);
+	}
+}
+
+void ExpandNormalRG16ToBGRA8(uint8* Pixels, const int64 NumPixels) {
+	int64 Pixel = 0;
+
+#if JSONASASSET_SWIZZLE_SSE2
+	const __m128i ByteMask = _mm_set1_epi32(0xFF);
+
+	for (; Pixel + 4 <= NumPixels; Pixel += 4) {
+		/* One pixel per lane, X16 | Y16 << 16, only the high byte of each is kept */
+		__m128i* Group = reinterpret_cast<__m128i*>(Pixels + Pixel * 4);
+		const __m128i Pairs = _mm_loadu_si128(Group);
+
+		_mm_storeu_si128(Group, BuildNormals(_mm_and_si128(_mm_srli_epi32(Pairs, 8), ByteMask), _mm_srli_epi32(Pairs, 24)));
+	}
+#endif
+
+	for (; Pixel < NumPixels; Pixel++) {
+		uint32 Value;
+		FMemory::Memcpy(&Value, Pixels + Pixel * 4, 4);
+
+		Value = BuildNormal(static_cast<uint8>(Value >> 8), static_cast<uint8>(Value >> 24));
+		FMemory::Memcpy(Pixels + Pixel * 4, &Value, 4);
+	}
+}
+
+void SetOpaqueAlphaRGBA16F(uint8* Pixels, const int64 NumPixels) {
+	/* 1.0 as a half float, in the top 16 bits of each pixel */
+	constexpr uint64 Alpha = static_cast<uint64>(0x3C00) << 48;
+	constexpr uint64 ColorMask = ~(static_cast<uint64>(0xFFFF) << 48);
+
+	int64 Pixel = 0;
+
+#if JSONASASSET_SWIZZLE_SSE2
+	const __m128i AlphaPair = _mm_set_epi16(0x3C00, 0, 0, 0, 0x3C00, 0, 0, 0);
+	const __m128i ColorMaskPair = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+
+	for (; Pixel + 2 <= NumPixels; Pixel += 2) {
+		__m128i* Pair = reinterpret_cast<__m128i*>(Pixels + Pixel * 8);
+		_mm_storeu_si128(Pair, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(Pair), ColorMaskPair), AlphaPair));
+	}
+#endif
+
+	for (; Pixel < NumPixels; Pixel++) {
+		uint64 Value;
+		FMemory::Memcpy(&Value, Pixels + Pixel * 8, 8);
+
+		Value = (Value & ColorMask) | Alpha;
+		FMemory::Memcpy(Pixels + Pixel * 8, &Value, 8);
+	}
+}
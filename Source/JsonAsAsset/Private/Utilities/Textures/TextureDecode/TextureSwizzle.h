@@ -0,0 +1,22 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * Expands a two-channel normal map (RG8, as BC5 decodes to) to BGRA8, with Z rebuilt from
+ * X and Y the same way NVTT does. Four pixels at a time with SSE2 where available.
+ *
+ * Source may be the second half of Dest: every group of pixels is read before it's written over.
+ */
+void ExpandNormalRG8ToBGRA8(const uint8* Source, uint8* Dest, int64 NumPixels);
+
+/* Same for RG16 (as EAC RG11 decodes to), in place, keeping the high byte of each channel */
+void ExpandNormalRG16ToBGRA8(uint8* Pixels, int64 NumPixels);
+
+/*
+ * Sets alpha to 1.0 on half float RGBA pixels, BC6H decodes to RGBX16 with X left at 0.
+ * Eight bytes per pixel, two pixels at a time with SSE2 where available.
+ */
+void SetOpaqueAlphaRGBA16F(uint8* Pixels, int64 NumPixels);
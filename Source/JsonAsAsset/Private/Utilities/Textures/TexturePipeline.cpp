@@ -0,0 +1,235 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Textures/TexturePipeline.h"
+
+#include "HttpManager.h"
+#include "HttpModule.h"
+#include "Async/Async.h"
+#include "Engine/Texture.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/Compatibility.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Textures/TextureCreatorUtilities.h"
+#include "Utilities/Textures/TexturePreview.h"
+#include "Utilities/Textures/TextureRowDecoder.h"
+
+namespace {
+#if ENGINE_UE5
+	typedef TSharedPtr<IHttpRequest> FPipelineRequestPtr;
+#else
+	typedef TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> FPipelineRequestPtr;
+#endif
+
+	struct FPipelineTexture {
+		FString ObjectPath;
+
+		EPixelFormat Format = PF_Unknown;
+		int32 SizeX = 0;
+		int32 SizeY = 0;
+
+		/* Encoded and decoded size, counted against the budget from the start of the download */
+		int64 Bytes = 0;
+
+		FPipelineRequestPtr Request;
+		bool bFailed = false;
+
+		/* Set once downloaded, Decoded belongs to the task until it completes */
+		TFuture<bool> Decode;
+		TArray64<uint8> Decoded;
+	};
+
+	typedef TSharedPtr<FPipelineTexture, ESPMode::ThreadSafe> FPipelineTexturePtr;
+
+	TMap<FString, FPipelineTexturePtr> Textures;
+
+	/* Not started yet, in import order */
+	TArray<FPipelineTexturePtr> Queue;
+
+	int32 Downloads = 0;
+	int64 BytesInFlight = 0;
+
+	int64 GetBudget() {
+		return static_cast<int64>(GetDefault<UJsonAsAssetSettings>()->AssetSettings.TextureImportSettings.TextureDecodeBudgetMB) * 1024 * 1024;
+	}
+
+	void Release(FPipelineTexture& Texture) {
+		BytesInFlight -= Texture.Bytes;
+		Texture.Bytes = 0;
+	}
+
+	void StartDownloads();
+
+	void StartDownload(const FPipelineTexturePtr& Texture) {
+		const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+		BytesInFlight += Texture->Bytes;
+		Downloads++;
+
+		Texture->Request = FHttpModule::Get().CreateRequest();
+		Texture->Request->SetURL(Settings->LocalFetchUrl + "/api/export?path=" + Texture->ObjectPath);
+		Texture->Request->SetHeader("content-type", "application/octet-stream");
+		Texture->Request->SetVerb(TEXT("GET"));
+
+		Texture->Request->OnProcessRequestComplete().BindLambda([Texture](FHttpRequestPtr Request, const FHttpResponsePtr Response, const bool bWasSuccessful) {
+			Downloads--;
+			Texture->Request.Reset();
+
+			/* Local Fetch answers with JSON when it has no data for the path */
+			if (!bWasSuccessful || !Response.IsValid() || Response->GetResponseCode() != 200 || Response->GetContentType().StartsWith("application/json")) {
+				Texture->bFailed = true;
+				Release(*Texture);
+				StartDownloads();
+
+				return;
+			}
+
+			/* The response is released as soon as it's decoded */
+			Texture->Decode = Async(EAsyncExecution::TaskGraph, [Texture, Response]() {
+				const TArray<uint8>& Content = Response->GetContent();
+
+				Texture->Decoded.SetNumUninitialized(FTextureRowDecoder::GetDecodedSize(Texture->Format, Texture->SizeX, Texture->SizeY));
+
+				FTextureRowDecoder Decoder(Texture->Format, Texture->SizeX, Texture->SizeY, Texture->Decoded.GetData());
+				Decoder.Decode(Content.GetData(), Content.Num());
+
+				return Decoder.IsComplete();
+			});
+
+			/* A download slot is free, the decoded bytes stay counted until the texture is taken */
+			StartDownloads();
+		});
+
+		if (!Texture->Request->ProcessRequest() && Texture->Request.IsValid()) {
+			Texture->Request->OnProcessRequestComplete().Unbind();
+			Texture->Request.Reset();
+			Texture->bFailed = true;
+
+			Downloads--;
+			Release(*Texture);
+		}
+	}
+
+	void StartDownloads() {
+		const int64 Budget = GetBudget();
+
+		/* The first texture always fits, however large it is */
+		while (Queue.Num() > 0 && Downloads < FTexturePipeline::MaxConcurrentDownloads && (BytesInFlight == 0 || BytesInFlight + Queue[0]->Bytes <= Budget)) {
+			const FPipelineTexturePtr Texture = Queue[0];
+			Queue.RemoveAt(0);
+
+			StartDownload(Texture);
+		}
+	}
+}
+
+void FTexturePipeline::Enqueue(const TArray<FString>& ObjectPaths) {
+	for (const FString& ExportedPath : ObjectPaths) {
+		/* Keyed the way Construct_TypeTexture asks for it */
+		const FString ObjectPath = FAssetUtilities::NormalizePackagePath(ExportedPath);
+
+		if (Textures.Contains(ObjectPath)) continue;
+
+		const TSharedPtr<FJsonObject> Response = FAssetUtilities::FindPrefetchedExport(ObjectPath);
+		if (!Response.IsValid()) continue;
+
+		const TArray<TSharedPtr<FJsonValue>>* Exports;
+		if (!Response->TryGetArrayField(TEXT("jsonOutput"), Exports) || Exports->Num() == 0) continue;
+
+		/* Only Texture2D has a single mip to decode, other types are created the usual way */
+		const TSharedPtr<FJsonObject> Export = (*Exports)[0]->AsObject();
+		if (!Export.IsValid() || Export->GetStringField(TEXT("Type")) != TEXT("Texture2D")) continue;
+
+		/* Imported with all its mips, which are decoded together once the whole payload is there */
+		if (FTextureCreatorUtilities::GetNumImportedMips(Export) > 1) continue;
+
+		/* Not decoded at all */
+		if (FTexturePreview::CanPassthrough(Export)) continue;
+
+		FString PixelFormat;
+		if (!Export->TryGetStringField(TEXT("PixelFormat"), PixelFormat)) continue;
+
+		const int64 Format = UTexture::GetPixelFormatEnum()->GetValueByNameString(PixelFormat);
+		if (Format == INDEX_NONE) continue;
+
+		const FPipelineTexturePtr Texture = MakeShared<FPipelineTexture, ESPMode::ThreadSafe>();
+		Texture->ObjectPath = ObjectPath;
+		Texture->Format = static_cast<EPixelFormat>(Format);
+		Texture->SizeX = Export->GetNumberField(TEXT("SizeX"));
+		Texture->SizeY = Export->GetNumberField(TEXT("SizeY"));
+
+		if (Texture->SizeX <= 0 || Texture->SizeY <= 0) continue;
+
+		Texture->Bytes = FTextureRowDecoder(Texture->Format, Texture->SizeX, Texture->SizeY, nullptr).GetPayloadSize()
+			+ FTextureRowDecoder::GetDecodedSize(Texture->Format, Texture->SizeX, Texture->SizeY);
+
+		Textures.Add(ObjectPath, Texture);
+		Queue.Add(Texture);
+	}
+
+	StartDownloads();
+}
+
+bool FTexturePipeline::Take(const FString& ObjectPath, TArray64<uint8>& OutDecoded) {
+	FPipelineTexturePtr Texture;
+	if (!Textures.RemoveAndCopyValue(FAssetUtilities::NormalizePackagePath(ObjectPath), Texture)) return false;
+
+	/* Needed now, whatever the budget says */
+	if (Queue.Remove(Texture) > 0) {
+		StartDownload(Texture);
+	}
+
+	/* Same loop as FRemoteUtilities::ExecuteRequestSync, other textures' downloads complete meanwhile */
+	if (Texture->Request.IsValid()) {
+		JSONASASSET_PHASE_SCOPE(Http);
+
+		double LastTime = FPlatformTime::Seconds();
+
+		while (Texture->Request.IsValid()) {
+			const double AppTime = FPlatformTime::Seconds();
+			FHttpModule::Get().GetHttpManager().Tick(AppTime - LastTime);
+			LastTime = AppTime;
+
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	bool bDecoded = false;
+
+	if (!Texture->bFailed && Texture->Decode.IsValid()) {
+		JSONASASSET_PHASE_SCOPE(TextureDecode);
+
+		bDecoded = Texture->Decode.Get();
+		OutDecoded = MoveTemp(Texture->Decoded);
+	}
+
+	Release(*Texture);
+	StartDownloads();
+
+	return bDecoded;
+}
+
+void FTexturePipeline::Reset() {
+	for (const TPair<FString, FPipelineTexturePtr>& Pair : Textures) {
+		const FPipelineTexturePtr& Texture = Pair.Value;
+
+		if (Texture->Request.IsValid()) {
+			Texture->Request->OnProcessRequestComplete().Unbind();
+			Texture->Request->CancelRequest();
+		}
+
+		/* Decodes write into the texture's buffer, let them finish before it goes */
+		if (Texture->Decode.IsValid()) {
+			Texture->Decode.Wait();
+		}
+	}
+
+	Textures.Empty();
+	Queue.Empty();
+
+	Downloads = 0;
+	BytesInFlight = 0;
+}
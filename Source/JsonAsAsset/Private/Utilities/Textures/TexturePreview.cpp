@@ -0,0 +1,139 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Textures/TexturePreview.h"
+
+#include "Engine/Texture.h"
+#include "UObject/UObjectGlobals.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Compatibility.h"
+#include "Utilities/ImportProfiler.h"
+#include "Utilities/Textures/TextureCreatorUtilities.h"
+
+#if ENGINE_UE5
+#include "UObject/ObjectSaveContext.h"
+#endif
+
+namespace {
+	TMap<TWeakObjectPtr<UTexture2D>, FTexturePreviewSource> Previews;
+
+	FDelegateHandle PreEditHandle;
+	FDelegateHandle PreSaveHandle;
+
+	void OnPreEdit(UObject* Object, const FEditPropertyChain& PropertyChain) {
+		if (UTexture2D* Texture = Cast<UTexture2D>(Object)) {
+			FTexturePreview::DecodeSource(Texture);
+		}
+	}
+
+#if ENGINE_UE5
+	void OnPreSave(UObject* Object, FObjectPreSaveContext SaveContext) {
+#else
+	void OnPreSave(UObject* Object) {
+#endif
+		if (UTexture2D* Texture = Cast<UTexture2D>(Object)) {
+			FTexturePreview::DecodeSource(Texture);
+		}
+	}
+}
+
+bool FTexturePreview::CanPassthrough(const TSharedPtr<FJsonObject>& Export) {
+	if (!GetDefault<UJsonAsAssetSettings>()->AssetSettings.TextureImportSettings.bFastPreview) return false;
+
+	FString PixelFormatName;
+	if (!Export->TryGetStringField(TEXT("PixelFormat"), PixelFormatName)) return false;
+
+	const int64 PixelFormat = UTexture::GetPixelFormatEnum()->GetValueByNameString(PixelFormatName);
+
+	switch (PixelFormat) {
+		/* What desktop platforms compress to, other formats still go through the engine */
+		case PF_DXT1:
+		case PF_DXT3:
+		case PF_DXT5:
+		case PF_BC4:
+		case PF_BC5:
+		case PF_BC6H:
+		case PF_BC7:
+			return GPixelFormats[PixelFormat].Supported;
+
+		default:
+			return false;
+	}
+}
+
+void FTexturePreview::Add(UTexture2D* Texture, FTexturePreviewSource&& Source) {
+	/* Previews that were deleted, or garbage collected without being saved */
+	for (auto It = Previews.CreateIterator(); It; ++It) {
+		if (!It.Key().IsValid()) {
+			It.RemoveCurrent();
+		}
+	}
+
+	Previews.Add(Texture, MoveTemp(Source));
+
+	if (!PreEditHandle.IsValid()) {
+		PreEditHandle = FCoreUObjectDelegates::OnPreObjectPropertyChanged.AddStatic(&OnPreEdit);
+#if ENGINE_UE5
+		PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&OnPreSave);
+#else
+		PreSaveHandle = FCoreUObjectDelegates::OnObjectSaved.AddStatic(&OnPreSave);
+#endif
+	}
+}
+
+bool FTexturePreview::DecodeSource(UTexture2D* Texture) {
+	FTexturePreviewSource* Found = Previews.Find(Texture);
+	if (Found == nullptr) return false;
+
+	const FTexturePreviewSource Source = MoveTemp(*Found);
+	Previews.Remove(Texture);
+
+	JSONASASSET_PHASE_SCOPE(TextureDecode);
+
+#if ENGINE_UE5
+	FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+#else
+	FTexturePlatformData* PlatformData = Texture->PlatformData;
+#endif
+
+	/* The platform data stays until the texture is built again, which replaces it. Its mips never stream, they're all in memory. */
+	TArray<const uint8*, TInlineAllocator<MAX_TEXTURE_MIP_COUNT>> MipPayloads;
+	bool bHasMips = PlatformData != nullptr && PlatformData->PixelFormat == Source.PixelFormat && PlatformData->Mips.Num() >= Source.NumSourceMips;
+
+	for (int32 Mip = 0; bHasMips && Mip < Source.NumSourceMips; Mip++) {
+		FTexture2DMipMap& MipMap = PlatformData->Mips[Mip];
+
+		bHasMips = MipMap.BulkData.GetBulkDataSize() >= FTextureRowDecoder(Source.PixelFormat, MipMap.SizeX, MipMap.SizeY, nullptr).GetPayloadSize();
+
+		if (bHasMips) {
+			MipPayloads.Add(static_cast<const uint8*>(MipMap.BulkData.LockReadOnly()));
+		}
+	}
+
+	if (bHasMips) {
+		Texture->Source.Init(Texture->GetSizeX(), Texture->GetSizeY(), 1, Source.NumSourceMips, Source.SourceFormat);
+		FTextureCreatorUtilities::DecodeSourceMips(Texture, Source.PixelFormat, MipPayloads);
+	} else {
+		UE_LOG(LogJson, Warning, TEXT("Preview texture \"%s\" was rebuilt before its source was decoded, it has no source"), *Texture->GetPathName());
+	}
+
+	for (int32 Mip = 0; Mip < MipPayloads.Num(); Mip++) {
+		PlatformData->Mips[Mip].BulkData.Unlock();
+	}
+
+	Texture->NeverStream = Source.bNeverStream;
+
+	if (Previews.Num() == 0) {
+		FCoreUObjectDelegates::OnPreObjectPropertyChanged.Remove(PreEditHandle);
+#if ENGINE_UE5
+		FCoreUObjectDelegates::OnObjectPreSave.Remove(PreSaveHandle);
+#else
+		FCoreUObjectDelegates::OnObjectSaved.Remove(PreSaveHandle);
+#endif
+
+		PreEditHandle.Reset();
+		PreSaveHandle.Reset();
+	}
+
+	return true;
+}
@@ -0,0 +1,76 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Textures/TextureRowDecoder.h"
+
+#include "RHI.h"
+#include "Utilities/Textures/TextureCreatorUtilities.h"
+
+FTextureRowDecoder::FTextureRowDecoder(const EPixelFormat InFormat, const int32 InSizeX, const int32 InSizeY, uint8* InDestination)
+	: Format(InFormat), SizeX(InSizeX), SizeY(InSizeY), Destination(InDestination) {
+	const FPixelFormatInfo& Info = GPixelFormats[Format];
+
+	BlockSizeY = FMath::Max(Info.BlockSizeY, 1);
+	BlockRowBytes = static_cast<int64>(FMath::DivideAndRoundUp(SizeX, FMath::Max(Info.BlockSizeX, 1))) * Info.BlockBytes;
+	NumBlockRows = FMath::DivideAndRoundUp(SizeY, BlockSizeY);
+}
+
+int64 FTextureRowDecoder::GetDecodedSize(const EPixelFormat Format, const int32 SizeX, const int32 SizeY) {
+	return static_cast<int64>(SizeX) * SizeY * GetDecodedBytesPerPixel(Format);
+}
+
+void FTextureRowDecoder::Decode(const uint8* Payload, const int64 Available) {
+	if (BlockRowBytes <= 0) return;
+
+	const int32 AvailableRows = static_cast<int32>(FMath::Min<int64>(Available / BlockRowBytes, NumBlockRows));
+	if (AvailableRows <= DecodedRows) return;
+
+	const int32 FirstPixelRow = DecodedRows * BlockSizeY;
+	const int32 PixelRows = FMath::Min(AvailableRows * BlockSizeY, SizeY) - FirstPixelRow;
+	const int32 BytesPerPixel = GetDecodedBytesPerPixel(Format);
+
+	uint8* Output = Destination + static_cast<int64>(FirstPixelRow) * SizeX * BytesPerPixel;
+
+	/* Decoders take the data as writable, they don't write to it */
+	FTextureCreatorUtilities::GetDecompressedTextureData(
+		const_cast<uint8*>(Payload) + DecodedRows * BlockRowBytes, Output,
+		SizeX, PixelRows, 1, PixelRows * SizeX * BytesPerPixel, Format
+	);
+
+	DecodedRows = AvailableRows;
+}
+
+bool FTextureRowDecoder::SetDecoded(const uint8* Decoded, const int64 Num) {
+	if (Num != GetDecodedSize(Format, SizeX, SizeY)) return false;
+
+	FMemory::Memcpy(Destination, Decoded, Num);
+	DecodedRows = NumBlockRows;
+
+	return true;
+}
+
+int32 FTextureRowDecoder::GetDecodedBytesPerPixel(const EPixelFormat Format) {
+	switch (Format) {
+		/* Single channel, G8 is copied and BC4 decoded to it */
+		case PF_G8:
+		case PF_BC4:
+			return 1;
+
+		/* 11 bits, widened to 16 */
+		case PF_ETC2_R11_EAC:
+			return 2;
+
+		/* Half float RGBA */
+		case PF_BC6H:
+			return 8;
+
+		/* Copied as they are */
+		case PF_B8G8R8A8:
+		case PF_FloatRGBA:
+		case PF_G16:
+			return GPixelFormats[Format].BlockBytes;
+
+		/* Everything else is decoded to BGRA8 */
+		default:
+			return 4;
+	}
+}
@@ -0,0 +1,27 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Utilities/Serializers/Containers/JsonExportView.h"
+
+/*
+ * Works out which references an import will download from Local Fetch and fetches
+ * their exports up front, in a few batched requests.
+ *
+ * Without this every missing reference (a material's textures, a parent material, a
+ * skeleton) costs its own round trip at the point the importer reaches it. Prefetched
+ * responses are used by FAssetUtilities::API_RequestExports and dropped when the
+ * outermost import finishes.
+ */
+class FDependencyPlanner {
+public:
+	static void Prefetch(const FJsonExportView& Exports);
+
+	/* Object paths as ConstructAsset requests them, "/Game/Path/Name.Name" */
+	static void CollectReferences(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPaths, TSet<FString>& OutTextures);
+
+private:
+	static bool IsMissing(const FString& ObjectPath);
+};
@@ -3,7 +3,6 @@
 #pragma once
 
 #include "Importers/Constructor/Importer.h"
-#include "Interfaces/IHttpRequest.h"
 #include "Sound/SoundNodeWavePlayer.h"
 
 /*
@@ -12,7 +11,7 @@
 */
 class ISoundGraph : public IImporter {
 public:
-	ISoundGraph(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects, UClass* AssetClass):
+	ISoundGraph(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const FJsonExportView& AllJsonObjects, UClass* AssetClass):
 		IImporter(FileName, FilePath, JsonObject, Package, OutermostPkg, AllJsonObjects, AssetClass) {
 	}
 
@@ -23,10 +22,6 @@ public:
 	/* Creates an empty USoundNode */
 	static USoundNode* CreateEmptyNode(FName Name, FName Type, USoundCue* SoundCue);
 
-	static void ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes);
-	void SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray) const;
-
-	/* Sound Wave Import */
-	void ImportSoundWave(const FString& URL, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) const;
-	static void OnDownloadSoundWave(FHttpRequestPtr Request, const FHttpResponsePtr& Response, bool bWasSuccessful, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node);
+	static void ConstructNodes(USoundCue* SoundCue, FJsonExportView JsonArray, TMap<FString, USoundNode*>& OutNodes);
+	void SetupNodes(USoundCue* SoundCueAsset, const TMap<FString, USoundNode*>& SoundCueNodes, FJsonExportView JsonObjectArray) const;
 };
@@ -0,0 +1,44 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundNodeWavePlayer.h"
+
+/*
+ * Downloads and imports the sound waves referenced by imported sound cues.
+ *
+ * Waves are queued by object path, so a wave shared by many wave players is downloaded
+ * and imported once. Files cached by earlier imports are reused when they are complete:
+ * downloads are written next to the cache file and moved in place, and the audio
+ * container's magic is checked before reuse.
+ *
+ * At most MaxConcurrentDownloads requests run at once. Downloaded files are imported in
+ * batches, one ImportAssetsAutomated call per destination folder, once the downloads
+ * in flight have finished or MaxImportBatchSize files are waiting.
+ *
+ * Runs on the game thread from the core ticker, which is only registered while waves
+ * are queued.
+ */
+class FSoundWaveImportQueue {
+public:
+	/* Sets the wave on the node once it's imported */
+	static void Enqueue(const FString& ObjectPath, USoundNodeWavePlayer* Node);
+
+	static constexpr int32 MaxConcurrentDownloads = 4;
+	static constexpr int32 MaxImportBatchSize = 64;
+
+	/* ProjectDir/Cache/<Package Folder>/<Asset Name>.<Extension> */
+	static FString GetCacheFile(const FString& ObjectPath);
+
+	/* Complete file of the configured audio format */
+	static bool IsCacheFileValid(const FString& File);
+
+private:
+	static bool Tick(float DeltaTime);
+
+	static void StartDownloads();
+	static void ImportReady();
+
+	static void Finish();
+};
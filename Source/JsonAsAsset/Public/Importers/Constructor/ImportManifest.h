@@ -0,0 +1,94 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utilities/Compatibility.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonValue.h"
+#include "Utilities/Serializers/Containers/JsonExportView.h"
+
+/*
+ * Remembers what each export file produced the last time it was imported, so an
+ * unchanged file can be skipped without reading it.
+ *
+ * Stored as a sidecar JSON file in Saved/JsonAsAsset. Each entry holds the MD5 of the
+ * file, the packages it created, and the hash of every referenced package's source file
+ * at the time. A file is only skipped when its own hash matches, its packages still exist,
+ * and none of the files it references have changed since, so editing one export also
+ * re-imports the assets that depend on it.
+ *
+ * File hashes are cached against the file's size and timestamp, a no-op re-import only
+ * stats the files instead of reading them.
+ */
+class FImportManifest {
+public:
+	/* The project's manifest, in Saved/JsonAsAsset */
+	static FImportManifest& Get();
+
+	/* A manifest stored somewhere else, loaded from ManifestFile if it exists */
+	explicit FImportManifest(const FString& InManifestFile);
+
+	/* Writes pending changes */
+	~FImportManifest();
+
+	/* True if the file and everything it references is unchanged since it was last imported */
+	bool IsUpToDate(const FString& File);
+
+	/* Records a finished import. With no packages the entry is dropped, so it's retried next time. */
+	void Record(const FString& File, const FJsonExportView& Exports, const TArray<FString>& Packages);
+
+	/* Writes pending changes to disk and releases the project's manifest, on module shutdown */
+	static void Flush();
+
+private:
+	struct FEntry {
+		FString Hash;
+		int64 Size = 0;
+		FDateTime Timestamp;
+
+		TArray<FString> Packages;
+
+		/* Package referenced by the file -> hash of that package's source file, empty if unknown */
+		TMap<FString, FString> Dependencies;
+	};
+
+	struct FCachedHash {
+		int64 Size = 0;
+		FDateTime Timestamp;
+		FString Hash;
+	};
+
+	void Load();
+	void Save();
+	void MarkDirty();
+
+	/* MD5 of a file's current contents, only read when its size or timestamp changed */
+	FString GetFileHash(const FString& File);
+
+	/* Hash of the import settings, a change invalidates every entry */
+	static FString GetSettingsHash();
+
+	static FString NormalizeFile(const FString& File);
+	static FString GetDefaultManifestFile();
+
+	static void CollectReferences(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPackages);
+
+	TMap<FString, FEntry> Entries;
+
+	/* Package -> export file that created it */
+	TMap<FString, FString> PackageSources;
+
+	TMap<FString, FCachedHash> HashCache;
+
+	FString ManifestFile;
+	FString SettingsHash;
+
+	bool bDirty = false;
+
+#if ENGINE_UE5
+	FTSTicker::FDelegateHandle SaveTickerHandle;
+#else
+	FDelegateHandle SaveTickerHandle;
+#endif
+};
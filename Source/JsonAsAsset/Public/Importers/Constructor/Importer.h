@@ -5,6 +5,7 @@
 #include "Utilities/Compatibility.h"
 #include "Utilities/EngineUtilities.h"
 #include "Utilities/JsonUtilities.h"
+#include "Utilities/Serializers/Containers/JsonExportView.h"
 #include "Dom/JsonObject.h"
 #include "CoreMinimal.h"
 #include "Utilities/Serializers/SerializerContainer.h"
@@ -52,15 +53,15 @@ public:
     /* Importer Constructor */
     IImporter(const FString& FileName, const FString& FilePath, 
               const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, 
-              UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects = {}, UClass* AssetClass = nullptr);
+              UPackage* OutermostPkg, const FJsonExportView& AllJsonObjects = {}, UClass* AssetClass = nullptr);
 
     virtual ~IImporter() override {}
 
     /* Easy way to find importers ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-    using FImporterFactoryDelegate = TFunction<IImporter*(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& Exports, UClass* AssetClass)>;
+    using FImporterFactoryDelegate = TFunction<IImporter*(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const FJsonExportView& Exports, UClass* AssetClass)>;
 
     template <typename T>
-    static IImporter* CreateImporter(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& Exports, UClass* AssetClass) {
+    static IImporter* CreateImporter(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const FJsonExportView& Exports, UClass* AssetClass) {
         return new T(FileName, FilePath, JsonObject, Package, OutermostPkg, Exports, AssetClass);
     }
 
@@ -101,7 +102,8 @@ public:
     }
 
 public:
-    TArray<TSharedPtr<FJsonValue>> AllJsonObjects;
+    /* Non-owning, the exports array is kept alive by the caller for the whole import */
+    FJsonExportView AllJsonObjects;
 
 protected:
     /* Class variables ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -192,8 +194,12 @@ public:
 
     /*
      * Searches for importable asset types and imports them.
+     * OutPackages receives the name of each package imported successfully.
+     *
+     * True if every importable export was imported. With bHideNotifications, only the
+     * first importable export is imported and its result is returned.
      */
-    static bool ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FString File, bool bHideNotifications = false);
+    static bool ReadExportsAndImport(FJsonExportView Exports, FString File, bool bHideNotifications = false, TArray<FString>* OutPackages = nullptr);
 
 public:
     TArray<TSharedPtr<FJsonValue>> GetObjectsWithTypeStartingWith(const FString& StartsWithStr);
@@ -31,6 +31,16 @@ public:
 private:
     void RegisterMenus();
 
+    /* Deferred work that doesn't need to hold up editor startup */
+    void OnEngineInitComplete();
+
+    /* Registers the style and commands, the first time a toolbar icon is drawn */
+    void InitializeUI();
+    bool bUIInitialized = false;
+
+    /* Menus are registered at startup, their icons are only resolved when drawn */
+    FSlateIcon GetToolbarIcon(FName StyleName);
+
     TSharedPtr<FUICommandList> PluginCommands;
     TSharedRef<SWidget> CreateToolbarDropdown();
     void CreateLocalFetchDropdown(FMenuBuilder MenuBuilder) const;
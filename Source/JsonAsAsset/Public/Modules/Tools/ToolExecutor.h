@@ -0,0 +1,126 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utilities/Compatibility.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+class SNotificationItem;
+
+/* One asset going through a tool */
+struct FToolItem {
+	FAssetData AssetData;
+	FString ObjectPath;
+
+	/* Filled by the fetch stage */
+	TSharedPtr<FJsonObject> Response;
+	TArray<TSharedPtr<FJsonValue>> Exports;
+
+	/* Whatever the tool's Transform read from the exports, for its Apply */
+	TSharedPtr<void, ESPMode::ThreadSafe> Prepared;
+
+	/* Set when the fetch failed or Local Fetch didn't find the asset, Apply is skipped */
+	bool bFailed = false;
+
+	/* The binary response didn't decode, fetched once more as JSON */
+	bool bRetryAsJson = false;
+	bool bRetriedAsJson = false;
+};
+
+typedef TSharedPtr<FToolItem, ESPMode::ThreadSafe> FToolItemPtr;
+
+/*
+ * Stages a tool plugs into FToolExecutor, called once per asset.
+ *
+ * Fetch (when bFetchExports is set) runs as concurrent non-blocking requests to Local Fetch,
+ * batched when it supports FExportBatch. Each response is parsed and Transform is called on a
+ * task graph worker, then Apply runs on the game thread within a per-frame time budget.
+ *
+ * Transform should do all the JSON work (finding exports, reading values) so that Apply only
+ * loads and modifies UObjects.
+ */
+struct FToolStages {
+	/* Game thread, before fetching. Return false to skip the asset. */
+	TFunction<bool(const FAssetData&)> Filter;
+
+	/* Worker thread, after fetching. Must not touch UObjects. Optional. */
+	TFunction<void(FToolItem&)> Transform;
+
+	/* Game thread, loads and modifies the asset */
+	TFunction<void(FToolItem&)> Apply;
+
+	/* Game thread, once every asset was applied or the tool was cancelled. Optional. */
+	TFunction<void(bool bCancelled)> Complete;
+
+	/* Request the asset's exports from Local Fetch before applying */
+	bool bFetchExports = true;
+};
+
+/*
+ * Runs a tool over a set of assets without blocking the editor.
+ * Shows a progress notification with a Cancel button.
+ */
+class FToolExecutor : public TSharedFromThis<FToolExecutor, ESPMode::ThreadSafe> {
+public:
+	static void Run(const FText& ToolName, const TArray<FAssetData>& Assets, const FToolStages& Stages);
+
+	/* Requests to Local Fetch in flight at once */
+	static constexpr int32 MaxConcurrentFetches = 8;
+
+	/* Game thread time spent applying per frame */
+	static constexpr double FrameBudgetSeconds = 0.008;
+
+	void Cancel();
+
+	FToolExecutor(const FText& InToolName, const FToolStages& InStages);
+
+private:
+	bool Tick(float DeltaTime);
+
+	void StartFetches();
+	void Fetch(const FToolItemPtr& Item);
+	void FetchBatch(const TArray<FToolItemPtr>& Items);
+	void ReadBatch(const TArray<FToolItemPtr>& Items, const TArray<uint8>& Content);
+	void Transform(const FToolItemPtr& Item, TArray<uint8>&& Content);
+	void ApplyReady();
+
+	void UpdateProgress() const;
+	void Finish();
+
+	FText ToolName;
+	FToolStages Stages;
+
+	/* Assets waiting for a fetch slot */
+	TArray<FToolItemPtr> Pending;
+	int32 NextPending = 0;
+
+	/* Single or batched requests */
+#if ENGINE_UE5
+	TMap<IHttpRequest*, TSharedRef<IHttpRequest>> InFlight;
+#else
+	TMap<IHttpRequest*, TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> InFlight;
+#endif
+
+	/* Fetched and transformed, waiting for the game thread */
+	TQueue<FToolItemPtr, EQueueMode::Mpsc> Ready;
+
+	int32 Total = 0;
+	int32 Completed = 0;
+	int32 Applied = 0;
+
+	TAtomic<bool> bCancelled;
+
+	TSharedPtr<SNotificationItem> Notification;
+
+#if ENGINE_UE5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
@@ -57,6 +57,9 @@ public:
 	/* Constructor to initialize default values */
 	FJTextureImportSettings()
 		: bDownloadExistingTextures(false)
+		, TextureDecodeBudgetMB(512)
+		, bImportAllMips(false)
+		, bFastPreview(false)
 	{}
 
 	/**
@@ -67,6 +70,36 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, Config, AdvancedDisplay, Category = "Texture Import Settings")
 	bool bDownloadExistingTextures;
+
+	/**
+	 * Memory for textures downloaded and decoded ahead of being created, in megabytes.
+	 *
+	 * Textures referenced by an import are downloaded and decoded in the background while earlier ones
+	 * are created. Lower this if large texture imports run out of memory.
+	 */
+	UPROPERTY(EditAnywhere, Config, AdvancedDisplay, Category = "Texture Import Settings", meta = (ClampMin = "0", DisplayName = "Texture Decode Memory Budget (MB)"))
+	int32 TextureDecodeBudgetMB;
+
+	/**
+	 * Imports every mip the export provides, instead of only the top one.
+	 *
+	 * The texture keeps its authored mips (TMGS_LeaveExistingMips), such as sharpened UI mips or custom
+	 * alpha mips, and the build doesn't generate them again. The whole payload is downloaded before the
+	 * mips are decoded in parallel.
+	 */
+	UPROPERTY(EditAnywhere, Config, AdvancedDisplay, Category = "Texture Import Settings")
+	bool bImportAllMips;
+
+	/**
+	 * Keeps the original block compressed mips of Texture2Ds as the texture's platform data, instead of
+	 * decoding them and having the engine compress them again.
+	 *
+	 * Only for BCn formats the editor can render. The texture has no source until it's edited or saved,
+	 * at which point the kept mips are decoded into it, the compression happens on the next build.
+	 * Meant for getting through large texture sets quickly.
+	 */
+	UPROPERTY(EditAnywhere, Config, AdvancedDisplay, Category = "Texture Import Settings")
+	bool bFastPreview;
 };
 
 /* Settings for sounds */
@@ -136,6 +169,25 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = Configuration)
 	FAssetSettings AssetSettings;
 
+	/**
+	 * Skips JSON files that haven't changed since they were last imported, as long as
+	 * their assets still exist and nothing they reference was re-exported.
+	 *
+	 * Changing any Asset Settings re-imports everything once.
+	 *
+	 * Off by default, as it also applies to files picked in the import dialog: with it
+	 * enabled, picking an unchanged file again doesn't re-import it.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = Configuration, meta = (DisplayName = "Skip Unchanged Imports"))
+	bool bSkipUnchangedImports = false;
+
+	/**
+	 * Writes a CSV with per-asset timings to Saved/JsonAsAsset/Profiles after each import,
+	 * and lists the slowest assets in the message log.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = Configuration, AdvancedDisplay, meta = (DisplayName = "Write Import Profiles"))
+	bool bWriteImportProfiles = false;
+
 	/* Enables experimental/developing features of JsonAsAsset. Features may not work as intended. */
 	UPROPERTY(EditAnywhere, Config, Category = Configuration, AdvancedDisplay)
 	bool bEnableExperiments;
@@ -20,7 +20,17 @@ public:
 	template <class T = UObject>
 	static bool ConstructAsset(const FString& Path, const FString& Type, TObjectPtr<T>& OutObject, bool& bSuccess);
 	
+	/* Package path of a reference as it's imported, "GameName/Content/Path" -> "/Game/Path", "Engine/Content/Path" -> "/Engine/Path" */
+	static FString NormalizePackagePath(const FString& PackagePath);
+
 	static bool Construct_TypeTexture(const FString& Path, const FString& FetchPath, UTexture*& OutTexture);
 
 	static TSharedPtr<FJsonObject> API_RequestExports(const FString& Path, const FString& FetchPath = "/api/export?raw=true&path=");
+
+	/* Requests exports in batches ahead of API_RequestExports, which then takes them without a round trip */
+	static void PrefetchExports(const TArray<FString>& Paths);
+	static void ClearPrefetchedExports();
+
+	/* Prefetched export without taking it, null if it wasn't prefetched */
+	static TSharedPtr<FJsonObject> FindPrefetchedExport(const FString& Path);
 };
@@ -0,0 +1,75 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FImportBenchmarkResult {
+	FString Fixture;
+	bool bImported = false;
+
+	double Seconds = 0.0;
+
+	/* Resident memory added by the import, and the process peak after it */
+	double MemoryDeltaMB = 0.0;
+	double PeakMemoryMB = 0.0;
+};
+
+/* One fixture fetched from Local Fetch with one transport setup */
+struct FTransportBenchmarkResult {
+	FString Fixture;
+
+	bool bBinary = false;
+	bool bGzip = false;
+	bool bKeepAlive = false;
+
+	/* Body as sent, and after decompression */
+	int64 WireBytes = 0;
+	int64 DecodedBytes = 0;
+
+	/* Request to parsed JSON. The first request includes connecting. */
+	double FirstMs = 0.0;
+	double AverageMs = 0.0;
+
+	/* Decoded body to FJsonValue tree, part of the above */
+	double ParseMs = 0.0;
+};
+
+/*
+ * Imports a directory of export JSON (see FSyntheticExports) and times each file.
+ *
+ * Results are compared against a baseline CSV. Anything slower or bigger than the
+ * baseline by more than the threshold is reported as a regression. Textures are only
+ * imported while FLocalFetchStandIn is running, it serves their data.
+ *
+ * Console commands, also usable headless through -ExecCmds:
+ *   JsonAsAsset.GenerateSyntheticExports [Scale] [Directory]
+ *   JsonAsAsset.Benchmark [Threshold] [-WriteBaseline]
+ *   JsonAsAsset.BenchmarkTransport [Repetitions]
+ *
+ * Each fixture in the baseline is also an automation test, Automation RunTests JsonAsAsset.Perf
+ */
+class JSONASASSET_API FImportBenchmark {
+public:
+	/* Fraction over the baseline that counts as a regression */
+	static constexpr float DefaultThreshold = 0.2f;
+
+	static TArray<FImportBenchmarkResult> Run(const FString& Directory);
+
+	/* One export file. False if it isn't imported by the benchmark, like the transport fixtures, or textures without the stand-in. */
+	static bool RunFixture(const FString& File, FImportBenchmarkResult& OutResult);
+
+	/* Returns the number of regressions, logged as errors */
+	static int32 CompareToBaseline(const FString& BaselineFile, const TArray<FImportBenchmarkResult>& Results, float Threshold);
+
+	static bool WriteResults(const FString& File, const TArray<FImportBenchmarkResult>& Results);
+	static bool ReadResults(const FString& File, TArray<FImportBenchmarkResult>& OutResults);
+
+	/* Resources/Benchmarks/Baseline.csv in the plugin. Checked in as generous budgets, -WriteBaseline replaces them with a machine's timings. */
+	static FString GetBaselineFile();
+
+	/* Fetches each fixture as JSON uncompressed on new connections, uncompressed kept alive, gzipped kept alive, then binary gzipped kept alive */
+	static TArray<FTransportBenchmarkResult> RunTransport(const TArray<FString>& Fixtures, int32 Repetitions);
+
+	static bool WriteTransportResults(const FString& File, const TArray<FTransportBenchmarkResult>& Results);
+};
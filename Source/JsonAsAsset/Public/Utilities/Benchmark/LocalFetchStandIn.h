@@ -0,0 +1,107 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Math/RandomStream.h"
+
+class FSocket;
+class FRunnableThread;
+
+struct FLocalFetchStandInOptions {
+	/* Export JSON to serve, FSyntheticExports output by default */
+	FString Directory;
+
+	int32 Port = 1500;
+
+	/* Added before every response */
+	int32 LatencyMs = 0;
+	int32 LatencyJitterMs = 0;
+
+	/* Per connection, 0 is unlimited */
+	int32 BandwidthKBps = 0;
+
+	/* Chance of answering with a 500 instead, 0 to 1 */
+	float ErrorRate = 0.0f;
+
+	int32 Seed = 1234;
+
+	/* What /api/name answers, the same as FSyntheticExports::GameName */
+	FString GameName = TEXT("JsonAsAssetBenchmark");
+};
+
+/*
+ * Loopback stand-in for Local Fetch, serving export JSON from a directory.
+ *
+ * Local Fetch needs Windows and real game archives. This serves the same endpoints
+ * from fixture files, with injectable latency, bandwidth caps and errors, so the
+ * network paths can be profiled anywhere:
+ *
+ *   /api/name                       Game name
+ *   /api/export?raw=true&path=X     {"jsonOutput": <X.json>}
+ *   /api/export?path=X              X.bin (texture or audio data) when present, X.json otherwise
+ *   POST /api/exports               Every path in the body, framed (see FExportBatch)
+ *
+ * Exports are sent in binary (see FJsonBinaryCache) to clients that accept it, responses
+ * are gzipped for clients sending Accept-Encoding: gzip, and connections are kept alive
+ * between requests.
+ *
+ * X is the object path, looked up as <Directory>/<Package Path>.json, then <Directory>/<Asset Name>.json.
+ *
+ * The listener and every connection run on their own threads. Imports block the game
+ * thread while waiting on a request, so the server can't be ticked from it.
+ */
+class JSONASASSET_API FLocalFetchStandIn final : public FRunnable {
+public:
+	static bool Launch(const FLocalFetchStandInOptions& Options);
+	static void Shutdown();
+	static bool IsRunning();
+
+	virtual ~FLocalFetchStandIn() override;
+
+	/* FRunnable */
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	explicit FLocalFetchStandIn(const FLocalFetchStandInOptions& InOptions);
+
+	bool Listen();
+	void HandleConnection(FSocket* Socket);
+
+	/* Returns false when the connection should be closed */
+	bool HandleRequest(FSocket* Socket, const FString& Header, const TArray<uint8>& RequestBody);
+
+	/* JSON bodies are gzipped when the client accepts it */
+	bool SendResponse(FSocket* Socket, int32 StatusCode, const FString& ContentType, const TArray<uint8>& Body, bool bGzip = false);
+	bool SendThrottled(FSocket* Socket, const uint8* Data, int32 Num);
+
+	/* {"jsonOutput": <fixture>} as text or in binary, false if there is no fixture */
+	bool ReadExport(const FString& ObjectPath, TArray<uint8>& OutBody, bool bBinary);
+	FString FindFixture(const FString& ObjectPath, const FString& Extension) const;
+
+	float NextRandom();
+
+	FLocalFetchStandInOptions Options;
+
+	FSocket* ListenSocket = nullptr;
+	FRunnableThread* Thread = nullptr;
+
+	FThreadSafeBool bStopping = false;
+	FThreadSafeCounter ActiveConnections;
+
+	FCriticalSection RandomLock;
+	FRandomStream Random;
+
+	/* Binary responses by fixture file */
+	FCriticalSection EncodedExportsLock;
+	TMap<FString, TArray<uint8>> EncodedExports;
+
+	FThreadSafeCounter RequestCount;
+	FThreadSafeCounter ErrorCount;
+	FThreadSafeCounter64 BytesSent;
+};
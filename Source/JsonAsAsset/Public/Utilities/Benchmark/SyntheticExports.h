@@ -0,0 +1,57 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Sizes of the generated fixtures */
+struct FSyntheticExportOptions {
+	int32 DataTableRows = 10000;
+	int32 MaterialExpressions = 500;
+	int32 SkeletonBones = 500;
+	int32 AnimationCurves = 100;
+	int32 AnimationKeys = 300;
+	int32 LevelActors = 5000;
+	int32 TextureSize = 2048;
+
+	/* Same seed, same files */
+	int32 Seed = 1234;
+
+	/* Multiplies every count above, for quick runs or stress runs */
+	float Scale = 1.0f;
+};
+
+/*
+ * Generates FModel-style export JSON for benchmarking the importers, without needing game files.
+ *
+ * Output is deterministic for a given set of options, so timings can be compared across
+ * runs and machines. Textures also get a raw .bin payload next to their JSON, in the
+ * layout Local Fetch serves it.
+ */
+class JSONASASSET_API FSyntheticExports {
+public:
+	/* Content path assets generated here are imported to */
+	static const TCHAR* PackagePath;
+
+	/* Game name references to other packages are exported with, "GameName/Content/Path" */
+	static const TCHAR* GameName;
+
+	static FString GetDefaultDirectory();
+
+	/* Writes every fixture to the directory, returns the JSON files written */
+	static TArray<FString> WriteCorpus(const FString& Directory, const FSyntheticExportOptions& Options);
+
+	static FString DataTable(const FString& Name, int32 Rows, int32 Seed);
+	static FString Material(const FString& Name, int32 Expressions, int32 Seed);
+
+	/* One texture sample per texture, referencing the texture fixtures as FModel exports references to other packages */
+	static FString TexturedMaterial(const FString& Name, const TArray<FString>& Textures);
+	static FString Skeleton(const FString& Name, int32 Bones, int32 Seed);
+	static FString AnimSequence(const FString& Name, int32 Curves, int32 Keys, int32 Seed);
+
+	/* Not importable, used for transport benchmarks */
+	static FString Level(const FString& Name, int32 Actors, int32 Seed);
+
+	/* Random blocks of a block compressed format or random G8 pixels, OutPayload gets the first NumMips mips one after the other */
+	static FString Texture2D(const FString& Name, const FString& PixelFormat, int32 Size, int32 Seed, TArray<uint8>& OutPayload, int32 NumMips = 1);
+};
@@ -54,6 +54,12 @@
 	#define UE5_2_BEYOND 0
 #endif
 
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	#define UE5_3_BEYOND 1
+#else
+	#define UE5_3_BEYOND 0
+#endif
+
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 2
 	#define UE5_1_BELOW 1
 #else
@@ -17,6 +17,8 @@
 #include "IDesktopPlatform.h"
 #include "RemoteUtilities.h"
 #include "AssetUtilities.h"
+#include "Json/MappedJsonReader.h"
+#include "Utilities/ImportProfiler.h"
 #include "PluginUtils.h"
 #include "HttpModule.h"
 #include "TlHelp32.h"
@@ -104,7 +106,7 @@ TEnum StringToEnum(const FString& StringValue) {
 	return StaticEnum<TEnum>() ? static_cast<TEnum>(StaticEnum<TEnum>()->GetValueByNameString(StringValue)) : TEnum();
 }
 
-inline TSharedPtr<FJsonObject> FindExport(const TSharedPtr<FJsonObject>& Export, const TArray<TSharedPtr<FJsonValue>>& File) {
+inline TSharedPtr<FJsonObject> FindExport(const TSharedPtr<FJsonObject>& Export, const FJsonExportView File) {
 	FString string_int; Export->GetStringField(TEXT("ObjectPath")).Split(".", nullptr, &string_int);
 	
 	return File[FCString::Atoi(*string_int)]->AsObject();
@@ -233,23 +235,18 @@ inline bool IsProcessRunning(const FString& ProcessName) {
 	return bIsRunning;
 }
 
-inline TSharedPtr<FJsonObject> GetExport(const FString& Type, TArray<TSharedPtr<FJsonValue>> AllJsonObjects, const bool bGetProperties = false) {
-	for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
-		const TSharedPtr<FJsonObject> ValueObject = Value->AsObject();
+inline TSharedPtr<FJsonObject> GetExport(const FString& Type, const FJsonExportView AllJsonObjects, const bool bGetProperties = false) {
+	const TSharedPtr<FJsonObject> ValueObject = AllJsonObjects.FindByType(Type);
+	if (!ValueObject.IsValid()) return nullptr;
 
-		if (ValueObject->GetStringField(TEXT("Type")) == Type) {
-			if (bGetProperties) {
-				return ValueObject->GetObjectField(TEXT("Properties"));
-			}
-			
-			return ValueObject;
-		}
+	if (bGetProperties) {
+		return ValueObject->GetObjectField(TEXT("Properties"));
 	}
 	
-	return nullptr;
+	return ValueObject;
 }
 
-inline TSharedPtr<FJsonObject> GetExport(const FJsonObject* PackageIndex, TArray<TSharedPtr<FJsonValue>> AllJsonObjects) {
+inline TSharedPtr<FJsonObject> GetExport(const FJsonObject* PackageIndex, const FJsonExportView AllJsonObjects) {
 	FString ObjectName = PackageIndex->GetStringField(TEXT("ObjectName")); /* Class'Asset:ExportName' */
 	FString ObjectPath = PackageIndex->GetStringField(TEXT("ObjectPath")); /* Path/Asset.Index */
 	FString Outer;
@@ -270,26 +267,19 @@ inline TSharedPtr<FJsonObject> GetExport(const FJsonObject* PackageIndex, TArray
 		ObjectName.Split(".", &Outer, &ObjectName);
 	}
 
-	int Index = 0;
+	/* Search for the object using the view's name index */
+	for (const int32 Index : AllJsonObjects.FindIndicesByName(ObjectName)) {
+		const TSharedPtr<FJsonObject> ValueObject = AllJsonObjects[Index]->AsObject();
 
-	/* Search for the object in the AllJsonObjects array */
-	for (const TSharedPtr<FJsonValue>& Value : AllJsonObjects) {
-		const TSharedPtr<FJsonObject> ValueObject = Value->AsObject();
+		if (ValueObject->HasField(TEXT("Outer")) && !Outer.IsEmpty()) {
+			FString OuterName = ValueObject->GetStringField(TEXT("Outer"));
 
-		FString Name;
-		if (ValueObject->TryGetStringField(TEXT("Name"), Name) && Name == ObjectName) {
-			if (ValueObject->HasField(TEXT("Outer")) && !Outer.IsEmpty()) {
-				FString OuterName = ValueObject->GetStringField(TEXT("Outer"));
-
-				if (OuterName == Outer) {
-					return AllJsonObjects[Index]->AsObject();
-				}
-			} else {
+			if (OuterName == Outer) {
 				return ValueObject;
 			}
+		} else {
+			return ValueObject;
 		}
-
-		Index++;
 	}
 
 	return nullptr;
@@ -307,26 +297,13 @@ inline bool IsProperExportData(const TSharedPtr<FJsonObject>& JsonObject) {
 }
 
 inline bool DeserializeJSON(const FString& FilePath, TArray<TSharedPtr<FJsonValue>>& JsonParsed) {
-	if (FPaths::FileExists(FilePath)) {
-		FString ContentBefore;
-		
-		if (FFileHelper::LoadFileToString(ContentBefore, *FilePath)) {
-			FString Content = FString(TEXT("{\"data\": "));
-			Content.Append(ContentBefore);
-			Content.Append(FString("}"));
-
-			const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
-
-			TSharedPtr<FJsonObject> JsonObject;
-			if (FJsonSerializer::Deserialize(JsonReader, JsonObject)) {
-				JsonParsed = JsonObject->GetArrayField(TEXT("data"));
-			
-				return true;
-			}
-		}
+	if (!FPaths::FileExists(FilePath)) {
+		return false;
 	}
 
-	return false;
+	JSONASASSET_PHASE_SCOPE(Parse);
+
+	return FMappedJsonReader::ReadFile(FilePath, JsonParsed);
 }
 
 inline bool DeserializeArrayJSON(const FString& String, TArray<TSharedPtr<FJsonValue>>& JsonParsed) {
@@ -442,30 +419,22 @@ inline TArray<FString> OpenFolderDialog(const FString& Title) {
 	return ReturnValue;
 }
 
-/* Filter to remove */
+/*
+ * Filter to remove
+ *
+ * Builds a new object, prefer passing FJsonPropertyFilter::Remove to DeserializeObjectProperties.
+ */
 inline TSharedPtr<FJsonObject> RemovePropertiesShared(const TSharedPtr<FJsonObject>& Input, const TArray<FString>& RemovedProperties) {
-	TSharedPtr<FJsonObject> ClonedJsonObject = MakeShareable(new FJsonObject(*Input));
-    
-	for (const FString& Property : RemovedProperties) {
-		if (ClonedJsonObject->HasField(Property)) {
-			ClonedJsonObject->RemoveField(Property);
-		}
-	}
-    
-	return ClonedJsonObject;
+	return FJsonPropertyFilter::Remove(RemovedProperties).Apply(Input);
 }
 
-/* Filter to whitelist */
-inline TSharedPtr<FJsonObject> KeepPropertiesShared(const TSharedPtr<FJsonObject>& Input, TArray<FString> WhitelistProperties) {
-	const TSharedPtr<FJsonObject> RawSharedPtrData = MakeShared<FJsonObject>();
-
-	for (const FString& Property : WhitelistProperties) {
-		if (Input->HasField(Property)) {
-			RawSharedPtrData->SetField(Property, Input->TryGetField(Property));
-		}
-	}
-
-	return RawSharedPtrData;
+/*
+ * Filter to whitelist
+ *
+ * Builds a new object, prefer passing FJsonPropertyFilter::Keep to DeserializeObjectProperties.
+ */
+inline TSharedPtr<FJsonObject> KeepPropertiesShared(const TSharedPtr<FJsonObject>& Input, const TArray<FString>& WhitelistProperties) {
+	return FJsonPropertyFilter::Keep(WhitelistProperties).Apply(Input);
 }
 
 inline void SavePluginConfig(UDeveloperSettings* EditorSettings) {
@@ -672,7 +641,7 @@ inline UObjectSerializer* CreateObjectSerializer() {
 	return ObjectSerializer;
 }
 
-inline TArray<TSharedPtr<FJsonValue>> GetExportsStartingWith(const FString& Start, const FString& Property, TArray<TSharedPtr<FJsonValue>> AllJsonObjects) {
+inline TArray<TSharedPtr<FJsonValue>> GetExportsStartingWith(const FString& Start, const FString& Property, const FJsonExportView AllJsonObjects) {
 	TArray<TSharedPtr<FJsonValue>> FilteredObjects;
 
 	for (const TSharedPtr<FJsonValue>& JsonObjectValue : AllJsonObjects) {
@@ -693,7 +662,7 @@ inline TArray<TSharedPtr<FJsonValue>> GetExportsStartingWith(const FString& Star
 	return FilteredObjects;
 }
 
-inline TSharedPtr<FJsonObject> GetExportStartingWith(const FString& Start, const FString& Property, TArray<TSharedPtr<FJsonValue>> AllJsonObjects, const bool bExportProperties = false) {
+inline TSharedPtr<FJsonObject> GetExportStartingWith(const FString& Start, const FString& Property, const FJsonExportView AllJsonObjects, const bool bExportProperties = false) {
 	for (const TSharedPtr<FJsonValue>& JsonObjectValue : AllJsonObjects) {
 		if (JsonObjectValue->Type == EJson::Object) {
 			TSharedPtr<FJsonObject> JsonObject = JsonObjectValue->AsObject();
@@ -717,7 +686,25 @@ inline TSharedPtr<FJsonObject> GetExportStartingWith(const FString& Start, const
 	return TSharedPtr<FJsonObject>();
 }
 
-inline TSharedPtr<FJsonObject> GetExportMatchingWith(const FString& Match, const FString& Property, TArray<TSharedPtr<FJsonValue>> AllJsonObjects, const bool bExportProperties = false) {
+inline TSharedPtr<FJsonObject> GetExportMatchingWith(const FString& Match, const FString& Property, const FJsonExportView AllJsonObjects, const bool bExportProperties = false) {
+	/* Exact name matches can use the view's name index */
+	if (Property == TEXT("Name")) {
+		for (const int32 Index : AllJsonObjects.FindIndicesByName(Match)) {
+			const TSharedPtr<FJsonObject> JsonObject = AllJsonObjects[Index]->AsObject();
+
+			/* The index is case-insensitive, Equals is not */
+			if (!JsonObject->GetStringField(Property).Equals(Match)) continue;
+
+			if (bExportProperties && JsonObject->HasField(TEXT("Properties"))) {
+				return JsonObject->GetObjectField(TEXT("Properties"));
+			}
+
+			return JsonObject;
+		}
+
+		return TSharedPtr<FJsonObject>();
+	}
+
 	for (const TSharedPtr<FJsonValue>& JsonObjectValue : AllJsonObjects) {
 		if (JsonObjectValue->Type == EJson::Object) {
 			TSharedPtr<FJsonObject> JsonObject = JsonObjectValue->AsObject();
@@ -0,0 +1,41 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/*
+ * Many exports from Local Fetch in one request.
+ *
+ * POST /api/exports with one object path per line. The response is a series of frames,
+ * each "<Object Path>\n<Byte Count>\n" followed by that many bytes of the usual
+ * {"jsonOutput": [...]} response, or its binary form when the request accepts it (see
+ * FJsonBinaryCache). Frames are split out of the body one at a time and parsed on their
+ * own, the body is never converted to a string.
+ *
+ * Local Fetch builds without the endpoint answer 404. That's remembered for the URL,
+ * callers then fall back to one request per path.
+ */
+class JSONASASSET_API FExportBatch {
+public:
+	static const TCHAR* Route;
+	static const TCHAR* ContentType;
+
+	static constexpr int32 MaxPathsPerRequest = 64;
+	static constexpr int32 MaxConcurrentRequests = 4;
+
+	static TArray<uint8> MakeRequestBody(const TArray<FString>& Paths);
+	static TArray<FString> ParseRequestBody(const TArray<uint8>& Body);
+
+	static void AppendFrame(TArray<uint8>& Out, const FString& Path, const uint8* Data, int32 Num);
+
+	/* Calls OnFrame for each frame in order, false if the data is malformed */
+	static bool ReadFrames(const TArray<uint8>& Content, TFunctionRef<void(const FString& Path, TArray<uint8>&& Json)> OnFrame);
+
+	/* Blocking, responses are added by object path. False if Local Fetch has no batch endpoint. */
+	static bool RequestExports(const TArray<FString>& Paths, TMap<FString, TSharedPtr<FJsonObject>>& OutResponses);
+
+	static bool IsSupported();
+	static void SetUnsupported();
+};
@@ -0,0 +1,84 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("JsonAsAsset"), STATGROUP_JsonAsAsset, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Parse JSON"), STAT_JsonAsAsset_Parse, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Package"), STAT_JsonAsAsset_CreatePackage, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Find Importer"), STAT_JsonAsAsset_FindImporter, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deserialize Properties"), STAT_JsonAsAsset_DeserializeProperties, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deserialize Property"), STAT_JsonAsAsset_DeserializeProperty, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Reference"), STAT_JsonAsAsset_ResolveReference, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HTTP Request"), STAT_JsonAsAsset_Http, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Texture Decode"), STAT_JsonAsAsset_TextureDecode, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Material Compile"), STAT_JsonAsAsset_MaterialCompile, STATGROUP_JsonAsAsset, JSONASASSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Package"), STAT_JsonAsAsset_SavePackage, STATGROUP_JsonAsAsset, JSONASASSET_API);
+
+/* Parts of an import that are timed separately */
+enum class EImportPhase : uint8 {
+	Parse,
+	CreatePackage,
+	FindImporter,
+	DeserializeProperties,
+	DeserializeProperty,
+	ResolveReference,
+	Http,
+	TextureDecode,
+	MaterialCompile,
+	SavePackage,
+
+	Count
+};
+
+/*
+ * Where import time goes, per asset.
+ *
+ * Phases show up as trace scopes (Unreal Insights) and in "stat JsonAsAsset".
+ * When profiling is enabled in the settings, each batch also writes a CSV with the
+ * time, bytes and call count of every phase per asset to Saved/JsonAsAsset/Profiles,
+ * and lists the slowest assets in the message log.
+ *
+ * Times are inclusive: an asset imported while resolving another one's references
+ * counts towards both.
+ */
+class JSONASASSET_API FImportProfiler {
+public:
+	/* Groups imports into one report, written when the outermost batch ends */
+	struct JSONASASSET_API FBatchScope {
+		FBatchScope();
+		~FBatchScope();
+	};
+
+	/* Phases from here on count towards this asset */
+	struct JSONASASSET_API FAssetScope {
+		FAssetScope(const FString& Name, const FString& Type, const FString& File);
+		~FAssetScope();
+
+	private:
+		bool bActive;
+	};
+
+	struct JSONASASSET_API FPhaseScope {
+		explicit FPhaseScope(EImportPhase InPhase);
+		~FPhaseScope();
+
+	private:
+		EImportPhase Phase;
+		uint64 StartCycles;
+		bool bActive;
+	};
+
+	/* Assets listed in the message log after each batch */
+	static constexpr int32 SlowestAssetCount = 10;
+};
+
+/* Trace scope, cycle stat and per-asset timing for one phase */
+#define JSONASASSET_PHASE_SCOPE(Phase) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(JsonAsAsset_##Phase); \
+	SCOPE_CYCLE_COUNTER(STAT_JsonAsAsset_##Phase); \
+	FImportProfiler::FPhaseScope ANONYMOUS_VARIABLE(JsonAsAssetPhase)(EImportPhase::Phase)
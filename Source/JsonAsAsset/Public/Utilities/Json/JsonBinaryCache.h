@@ -0,0 +1,63 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utilities/Json/MappedJsonReader.h"
+
+/*
+ * Parsed exports saved in a compact binary form, keyed by the MD5 of the JSON they came from.
+ *
+ * Shared parents, master materials and skeletons are read again by every import that
+ * references them. The first read parses the JSON and writes the tree to
+ * Intermediate/JsonAsAsset/ExportCache. Later reads of the same contents map that file and
+ * rebuild the tree without tokenizing anything: strings stay in the mapped file, keys are
+ * converted once, and number arrays are copied in one go.
+ *
+ * Files are touched on every hit. Trim, run once per editor session, drops the files of
+ * an older cache version, files unused for MaxCacheAgeDays, and then the least recently used
+ * ones until the cache fits in MaxCacheBytes.
+ *
+ * Local Fetch can send exports in the same form (ContentType, asked for through the Accept
+ * header), which skips tokenizing on this side entirely. Text JSON stays the fallback.
+ * Over HTTP the form carries WireVersion instead of the cache's own version, so bumping the
+ * cache doesn't break Local Fetch builds that send the old layout.
+ */
+class FJsonBinaryCache {
+public:
+	/* Export file, from the cache when its contents were read before */
+	static bool ReadFile(const FString& File, TArray<TSharedPtr<FJsonValue>>& OutArray, FJsonReadStats* OutStats = nullptr);
+
+	/* JSON already in memory, like a Local Fetch response body */
+	static TSharedPtr<FJsonValue> ReadBuffer(TArray<uint8>&& Bytes, const FString& Name, FJsonReadStats* OutStats = nullptr);
+
+	static FString GetCacheDirectory();
+
+	static constexpr int64 MaxCacheBytes = 2048ll * 1024 * 1024;
+	static constexpr int32 MaxCacheAgeDays = 30;
+
+	/* Evicts cache files as described above. Only reads and deletes files, safe on any thread. */
+	static void Trim(const FString& Directory = GetCacheDirectory(), int64 MaxBytes = MaxCacheBytes, FTimespan MaxAge = FTimespan::FromDays(MaxCacheAgeDays));
+
+	/* MIME type of the binary form when sent over HTTP, without its version */
+	static const TCHAR* ContentType;
+
+	/* Version of the binary form sent over HTTP. Bump only when the layout changes. */
+	static constexpr uint32 WireVersion = 1;
+
+	/* ContentType with WireVersion as a parameter, for the Accept and Content-Type headers */
+	static FString GetWireContentType();
+
+	/* Binary form rather than JSON text, of any version */
+	static bool IsEncoded(const TArray<uint8>& Bytes);
+
+	/* The form sent over HTTP, Decode fails on any other WireVersion */
+	static void Encode(const TSharedPtr<FJsonValue>& Value, TArray<uint8>& OutBytes);
+	static TSharedPtr<FJsonValue> Decode(TArray<uint8>&& Bytes, FJsonReadStats* OutStats = nullptr);
+
+private:
+	static TSharedPtr<FJsonValue> Read(const TSharedPtr<FJsonSource>& Source, const FString& Name, FJsonReadStats* OutStats);
+
+	static TSharedPtr<FJsonValue> Load(const FString& CacheFile, FJsonReadStats& OutStats);
+	static void Save(const FString& CacheFile, const TSharedPtr<FJsonValue>& Value);
+};
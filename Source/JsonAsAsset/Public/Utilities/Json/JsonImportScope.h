@@ -0,0 +1,66 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Utilities/Json/JsonBinaryCache.h"
+
+/*
+ * Owns the exports read for one import and decides how they are released.
+ *
+ * Destroying a large tree frees every object, value and key one by one, which can
+ * stall the editor for seconds at the end of an import. When the scope ends, its
+ * exports are handed to a release queue that the game thread drains in small
+ * batches each frame instead. Releasing stays on the game thread, since
+ * TSharedPtr reference counts aren't thread safe and importers may still hold parts
+ * of the tree.
+ *
+ * The nodes aren't put in an arena: FJsonObject keeps its fields in a TMap of FStrings
+ * on the default allocator, a TSharedPtr with a custom deleter allocates its reference
+ * controller separately, and importers keep parts of the tree after the import (the
+ * object serializer's exports, cached objects), so resetting an arena would leave them
+ * dangling.
+ */
+
+/* How long releasing the last queued exports took, for profiling */
+struct FJsonReleaseStats {
+	int32 Exports = 0;
+	int32 Batches = 0;
+
+	double Seconds = 0.0;
+	double LongestBatchSeconds = 0.0;
+};
+
+class FJsonImportScope {
+public:
+	explicit FJsonImportScope(const FString& InFile)
+		: File(InFile) {
+	}
+
+	~FJsonImportScope();
+
+	bool ReadFile() {
+		return FJsonBinaryCache::ReadFile(File, Exports, &Stats);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& GetExports() const { return Exports; }
+	const FJsonReadStats& GetStats() const { return Stats; }
+
+	/* Releases everything still queued, on module shutdown */
+	static void Flush();
+
+	/* Releases one frame's budget of queued exports, false once the queue is empty */
+	static bool ReleaseBatch();
+
+	static const FJsonReleaseStats& GetLastRelease();
+
+	/* Game thread time spent releasing queued exports per frame */
+	static constexpr double ReleaseBudgetSeconds = 0.004;
+
+private:
+	FString File;
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	FJsonReadStats Stats;
+};
@@ -0,0 +1,145 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/*
+ * UTF-8 bytes of a JSON file, memory-mapped when the platform supports it,
+ * read into memory otherwise. Kept alive by every string value that points into it.
+ */
+class FJsonSource {
+public:
+	~FJsonSource();
+
+	static TSharedPtr<FJsonSource> Open(const FString& File);
+
+	/* Takes over bytes already in memory, like an HTTP response body */
+	static TSharedPtr<FJsonSource> FromBuffer(TArray<uint8>&& Bytes);
+
+	const ANSICHAR* GetData() const { return Data; }
+	int64 Num() const { return Size; }
+
+private:
+	FJsonSource() {}
+
+	const ANSICHAR* Data = nullptr;
+	int64 Size = 0;
+
+	/* Region has to be released before the handle */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/* Fallback when mapping isn't available */
+	TArray<uint8> Buffer;
+};
+
+/*
+ * String value pointing into the source's UTF-8 bytes.
+ * Only converted to an FString when something actually reads it.
+ */
+class FJsonValueUtf8String : public FJsonValue {
+public:
+	FJsonValueUtf8String(const TSharedPtr<FJsonSource>& InSource, const int64 InOffset, const int32 InLength)
+		: Source(InSource), Offset(InOffset), Length(InLength) {
+		Type = EJson::String;
+	}
+
+	virtual bool TryGetString(FString& OutString) const override;
+	virtual bool TryGetNumber(double& OutDouble) const override;
+	virtual bool TryGetBool(bool& OutBool) const override;
+
+protected:
+	virtual FString GetType() const override { return TEXT("String"); }
+
+private:
+	TSharedPtr<FJsonSource> Source;
+	int64 Offset;
+	int32 Length;
+};
+
+/*
+ * All-number array, stored as one contiguous buffer instead of an FJsonValueNumber per element.
+ *
+ * Code that doesn't know about it still works: TryGetArray / AsArray expand it
+ * (once) into regular values. Use GetNumbers / TryGetNumberArray to skip that.
+ *
+ * Trees are shared with worker threads (tools parse and read exports off the game thread),
+ * so the expansion is done under a lock. The numbers themselves are never modified.
+ */
+class FJsonValuePackedNumbers : public FJsonValue {
+public:
+	explicit FJsonValuePackedNumbers(TArray<double>&& InNumbers)
+		: Numbers(MoveTemp(InNumbers)) {
+		Type = EJson::Array;
+	}
+
+	virtual bool TryGetArray(const TArray<TSharedPtr<FJsonValue>>*& OutArray) const override;
+
+	TArrayView<const double> GetNumbers() const { return Numbers; }
+
+	/* The packed array behind a value, or nullptr if it's anything else. Doesn't allocate or expand. */
+	static const FJsonValuePackedNumbers* Cast(const FJsonValue* Value);
+
+	static const FJsonValuePackedNumbers* Cast(const TSharedPtr<FJsonValue>& Value) {
+		return Cast(Value.Get());
+	}
+
+protected:
+	virtual FString GetType() const override { return TEXT("Number Array"); }
+
+private:
+	TArray<double> Numbers;
+
+	/* Filled on the first TryGetArray */
+	mutable TArray<TSharedPtr<FJsonValue>> Expanded;
+	mutable bool bExpanded = false;
+	mutable FCriticalSection ExpandLock;
+};
+
+/* What a read allocated, for profiling */
+struct FJsonReadStats {
+	int64 Bytes = 0;
+	int64 Objects = 0;
+	int64 Values = 0;
+
+	/* Strings left in the source instead of converted */
+	int64 Slices = 0;
+
+	/* Numbers stored in packed arrays instead of one value each */
+	int64 PackedNumbers = 0;
+
+	/* Loaded from the binary export cache instead of parsed */
+	bool bFromCache = false;
+
+	double Seconds = 0.0;
+};
+
+/*
+ * Reads JSON files without widening them to TCHAR first.
+ *
+ * The file is tokenized as UTF-8 in place, unescaped strings become FJsonValueUtf8String
+ * slices, and object keys are converted once per file and reused for every object
+ * that has them ("Type", "Name", "Outer", "Properties", ...).
+ *
+ * Arrays made only of numbers become FJsonValuePackedNumbers, and true / false / null
+ * are shared values.
+ *
+ * Otherwise produces the same FJsonObject / FJsonValue tree as FJsonSerializer.
+ */
+class FMappedJsonReader {
+public:
+	static TSharedPtr<FJsonValue> ReadFile(const FString& File, FJsonReadStats* OutStats = nullptr);
+
+	/* Parses an already opened source, Name is only used for errors */
+	static TSharedPtr<FJsonValue> Read(const TSharedPtr<FJsonSource>& Source, const FString& Name, FJsonReadStats* OutStats = nullptr);
+
+	/* For export files, which are a top level array */
+	static bool ReadFile(const FString& File, TArray<TSharedPtr<FJsonValue>>& OutArray, FJsonReadStats* OutStats = nullptr);
+};
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Utilities/Json/MappedJsonReader.h"
+
 struct FExportData {
 	FExportData(const FName Type, const FName Outer, const TSharedPtr<FJsonObject>& Json) {
 		this->Type = Type;
@@ -55,3 +57,46 @@ inline FRichCurveKey ObjectToRichCurveKey(const TSharedPtr<FJsonObject>& Object)
 	
 	return FRichCurveKey(Object->GetNumberField(TEXT("Time")), Object->GetNumberField(TEXT("Value")), Object->GetNumberField(TEXT("ArriveTangent")), Object->GetNumberField(TEXT("LeaveTangent")), static_cast<ERichCurveInterpMode>(StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(InterpMode)));
 }
+
+/* Number Arrays ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+/* Reads an all-number array, straight from the buffer when the reader packed it */
+template <typename T>
+bool TryGetNumberArray(const TSharedPtr<FJsonValue>& Value, TArray<T>& OutNumbers) {
+	if (const FJsonValuePackedNumbers* Packed = FJsonValuePackedNumbers::Cast(Value)) {
+		const TArrayView<const double> Numbers = Packed->GetNumbers();
+		OutNumbers.SetNumUninitialized(Numbers.Num());
+
+		for (int32 Index = 0; Index < Numbers.Num(); Index++) {
+			OutNumbers[Index] = static_cast<T>(Numbers[Index]);
+		}
+
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (!Value.IsValid() || !Value->TryGetArray(Array)) {
+		return false;
+	}
+
+	OutNumbers.SetNumUninitialized(Array->Num());
+
+	for (int32 Index = 0; Index < Array->Num(); Index++) {
+		double Number;
+		if (!(*Array)[Index].IsValid() || !(*Array)[Index]->TryGetNumber(Number)) {
+			OutNumbers.Reset();
+			return false;
+		}
+
+		OutNumbers[Index] = static_cast<T>(Number);
+	}
+
+	return true;
+}
+
+template <typename T>
+bool TryGetNumberArrayField(const TSharedPtr<FJsonObject>& Object, const FString& Key, TArray<T>& OutNumbers) {
+	const TSharedPtr<FJsonValue>* Value = Object->Values.Find(Key);
+
+	return Value != nullptr && TryGetNumberArray(*Value, OutNumbers);
+}
@@ -14,4 +14,30 @@ public:
 #else
 	static TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> ExecuteRequestSync(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, float LoopDelay = 0.1);
 #endif
+
+	/* Calls WhileWaiting between polls, to work on a response body as it streams in */
+#if ENGINE_UE5
+	static TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> ExecuteRequestSync(TSharedRef<IHttpRequest> HttpRequest, TFunctionRef<void()> WhileWaiting, float LoopDelay = 0.01);
+#else
+	static TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> ExecuteRequestSync(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, TFunctionRef<void()> WhileWaiting, float LoopDelay = 0.01);
+#endif
+
+	/*
+	 * Asks Local Fetch for exports in binary (see FJsonBinaryCache), gzipped. Servers without
+	 * the binary form send JSON text. Only for export requests, raw texture and audio data
+	 * barely compresses and is left as is.
+	 *
+	 * Connections are reused by the HTTP module's own pooling (keep-alive is the default in
+	 * HTTP/1.1), there is no header for it.
+	 */
+	static void SetTransportHeaders(IHttpRequest& HttpRequest);
+
+	/*
+	 * Asks for JSON text only for the rest of the session. Called when a binary response doesn't
+	 * decode (a Local Fetch build with another wire version), and the request is retried.
+	 */
+	static void DisableBinaryTransport();
+
+	/* Response body, decompressed when the server sent it gzipped */
+	static TArray<uint8> GetDecodedContent(const FHttpResponsePtr& Response);
 };
@@ -0,0 +1,97 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Dom/JsonObject.h"
+
+/*
+ * Non-owning view over an array of exports.
+ *
+ * Passed around by value instead of copying TArray<TSharedPtr<FJsonValue>>,
+ * which would touch every reference count. The array it was created from must
+ * outlive the view (the importer's exports live for the whole import), don't
+ * keep one past the call or importer it was given to. UObjectSerializer, which
+ * outlives imports, copies the array in SetupExports.
+ *
+ * Name and Type lookups build an index on first use, the index is shared
+ * between copies of the same view.
+ */
+struct FJsonExportView {
+	FJsonExportView() {}
+
+	/* Implicit, so existing TArray call sites keep working */
+	FJsonExportView(const TArray<TSharedPtr<FJsonValue>>& InExports)
+		: Exports(InExports), Lookup(MakeShared<FLookup>()) {
+	}
+
+	int32 Num() const { return Exports.Num(); }
+	bool IsEmpty() const { return Exports.Num() == 0; }
+	bool IsValidIndex(const int32 Index) const { return Exports.IsValidIndex(Index); }
+
+	const TSharedPtr<FJsonValue>& operator[](const int32 Index) const { return Exports[Index]; }
+
+	const TSharedPtr<FJsonValue>* begin() const { return Exports.GetData(); }
+	const TSharedPtr<FJsonValue>* end() const { return Exports.GetData() + Exports.Num(); }
+
+	/* Indices (in export order) of every export with the given "Name" */
+	const TArray<int32>& FindIndicesByName(const FString& Name) const {
+		BuildLookup();
+
+		const TArray<int32>* Found = Lookup.IsValid() ? Lookup->ByName.Find(Name) : nullptr;
+		return Found ? *Found : EmptyIndices();
+	}
+
+	/* Indices (in export order) of every export with the given "Type" */
+	const TArray<int32>& FindIndicesByType(const FString& Type) const {
+		BuildLookup();
+
+		const TArray<int32>* Found = Lookup.IsValid() ? Lookup->ByType.Find(Type) : nullptr;
+		return Found ? *Found : EmptyIndices();
+	}
+
+	/* First export with the given "Name" */
+	TSharedPtr<FJsonObject> FindByName(const FString& Name) const {
+		const TArray<int32>& Indices = FindIndicesByName(Name);
+		return Indices.Num() > 0 ? Exports[Indices[0]]->AsObject() : TSharedPtr<FJsonObject>();
+	}
+
+	/* First export with the given "Type" */
+	TSharedPtr<FJsonObject> FindByType(const FString& Type) const {
+		const TArray<int32>& Indices = FindIndicesByType(Type);
+		return Indices.Num() > 0 ? Exports[Indices[0]]->AsObject() : TSharedPtr<FJsonObject>();
+	}
+
+private:
+	struct FLookup {
+		bool bBuilt = false;
+
+		TMap<FString, TArray<int32>> ByName;
+		TMap<FString, TArray<int32>> ByType;
+	};
+
+	static const TArray<int32>& EmptyIndices() {
+		static const TArray<int32> Empty;
+		return Empty;
+	}
+
+	void BuildLookup() const {
+		if (!Lookup.IsValid() || Lookup->bBuilt) return;
+
+		for (int32 Index = 0; Index < Exports.Num(); Index++) {
+			const TSharedPtr<FJsonValue>& Value = Exports[Index];
+			if (!Value.IsValid() || Value->Type != EJson::Object) continue;
+
+			const TSharedPtr<FJsonObject> Object = Value->AsObject();
+
+			FString Field;
+			if (Object->TryGetStringField(TEXT("Name"), Field)) Lookup->ByName.FindOrAdd(Field).Add(Index);
+			if (Object->TryGetStringField(TEXT("Type"), Field)) Lookup->ByType.FindOrAdd(Field).Add(Index);
+		}
+
+		Lookup->bBuilt = true;
+	}
+
+	TArrayView<const TSharedPtr<FJsonValue>> Exports;
+	TSharedPtr<FLookup> Lookup;
+};
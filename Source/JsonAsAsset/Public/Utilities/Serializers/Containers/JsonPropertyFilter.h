@@ -0,0 +1,64 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "Dom/JsonObject.h"
+
+/*
+ * Key mask applied on top of a properties object while deserializing.
+ *
+ * Hides fields from the deserializer without cloning the FJsonObject,
+ * either by removing a few keys or by only keeping a few keys.
+ */
+struct FJsonPropertyFilter {
+	FJsonPropertyFilter() : bWhitelist(false) {}
+
+	/* Hide these properties, everything else is deserialized */
+	static FJsonPropertyFilter Remove(const TArray<FString>& Properties) {
+		return FJsonPropertyFilter(Properties, false);
+	}
+
+	/* Only deserialize these properties */
+	static FJsonPropertyFilter Keep(const TArray<FString>& Properties) {
+		return FJsonPropertyFilter(Properties, true);
+	}
+
+	/* No filtering at all */
+	bool IsEmpty() const {
+		return !bWhitelist && Properties.Num() == 0;
+	}
+
+	bool IsVisible(const FString& Key) const {
+		if (IsEmpty()) return true;
+
+		const bool bListed = Properties.Contains(Key);
+		return bWhitelist ? bListed : !bListed;
+	}
+
+	bool HasField(const TSharedPtr<FJsonObject>& Object, const FString& Key) const {
+		return IsVisible(Key) && Object->HasField(Key);
+	}
+
+	/* Builds a filtered copy, only for consumers that need a plain FJsonObject */
+	TSharedPtr<FJsonObject> Apply(const TSharedPtr<FJsonObject>& Input) const {
+		if (IsEmpty()) return Input;
+
+		TSharedPtr<FJsonObject> Output = MakeShared<FJsonObject>();
+
+		for (const auto& Pair : Input->Values) {
+			if (IsVisible(Pair.Key)) {
+				Output->SetField(Pair.Key, Pair.Value);
+			}
+		}
+
+		return Output;
+	}
+
+private:
+	FJsonPropertyFilter(const TArray<FString>& InProperties, const bool bInWhitelist)
+		: Properties(InProperties), bWhitelist(bInWhitelist) {
+	}
+
+	TArray<FString> Properties;
+	bool bWhitelist;
+};
@@ -4,6 +4,8 @@
 
 #include "UObject/Object.h"
 #include "Json.h"
+#include "Containers/JsonExportView.h"
+#include "Containers/JsonPropertyFilter.h"
 #include "ObjectUtilities.generated.h"
 
 class UPropertySerializer;
@@ -15,14 +17,20 @@ public:
     UObjectSerializer();
 
     void SetPropertySerializer(UPropertySerializer* NewPropertySerializer);
-    void SetupExports(const TArray<TSharedPtr<FJsonValue>>& InObjects);
+
+    /* Keeps its own copy of the array, the serializer outlives the import that set it up */
+    void SetupExports(const FJsonExportView& InObjects);
+
+    /* View over the exports given to SetupExports */
+    const FJsonExportView& GetExports() const { return Exports; }
 
     FORCEINLINE UPropertySerializer* GetPropertySerializer() const { return PropertySerializer; }
 
-    void DeserializeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object) const;
+    /* Filter hides fields of Properties from deserialization without copying it */
+    void DeserializeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object, const FJsonPropertyFilter& Filter = FJsonPropertyFilter()) const;
 
     void SetExportForDeserialization(const TSharedPtr<FJsonObject>& Object);
-    void DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExports);
+    void DeserializeExports(FJsonExportView InExports);
 
     UPROPERTY()
     UObject* ParentAsset;
@@ -30,8 +38,10 @@ public:
     UPROPERTY()
     UPropertySerializer* PropertySerializer;
 
-    TArray<TSharedPtr<FJsonValue>> Exports;
-
     UPROPERTY()
     TArray<FString> ExportsToNotDeserialize;
+
+private:
+    TArray<TSharedPtr<FJsonValue>> ExportsStorage;
+    FJsonExportView Exports;
 };
\ No newline at end of file
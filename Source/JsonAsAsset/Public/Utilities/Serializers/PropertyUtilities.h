@@ -65,7 +65,7 @@ private:
 };
 
 /* Use to handle differentiating formats produced by CUE4Parse */
-inline bool PassthroughPropertyHandler(FProperty* Property, const FString& PropertyName, void* PropertyValue, const TSharedPtr<FJsonObject>& Properties, UPropertySerializer* PropertySerializer) {
+inline bool PassthroughPropertyHandler(FProperty* Property, const FString& PropertyName, void* PropertyValue, const TSharedPtr<FJsonObject>& Properties, UPropertySerializer* PropertySerializer, const FJsonPropertyFilter& Filter = FJsonPropertyFilter()) {
 	/* Handles static arrays in the format of: PropertyName[Index] */
 	if (Property->ArrayDim != 1) {
 		TArray<TSharedPtr<FJsonValue>> ArrayElements;
@@ -78,6 +78,9 @@ inline bool PassthroughPropertyHandler(FProperty* Property, const FString& Prope
 			/* If it doesn't start with the same property name */
 			if (!Key.StartsWith(PropertyName)) continue;
 
+			/* Hidden by the caller's filter */
+			if (!Filter.IsVisible(Key)) continue;
+
 			/* By default, it should be 0 */
 			int32 CurrentArrayIndex = 0;
 
@@ -0,0 +1,63 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "StructSerializer.h"
+
+/*
+ * Direct decoders for the math and core structs that make up most of the values in
+ * skeleton, mesh, animation and level exports. They read the known field names
+ * straight into struct memory instead of walking the struct with reflection.
+ *
+ * Fields missing from the JSON are left untouched, like the fallback serializer does.
+ */
+
+class FVectorSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FVector2DSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FRotatorSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FQuatSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FTransformSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FLinearColorSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FColorSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FGuidSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FIntPointSerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
+
+class FRichCurveKeySerializer : public FStructSerializer {
+public:
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override;
+};
@@ -4,6 +4,7 @@
 
 #include "Utilities/Serializers/PropertyUtilities.h"
 #include "Dom/JsonObject.h"
+#include "Utilities/Textures/TextureRowDecoder.h"
 
 struct FTextureCreatorUtilities {
 public:
@@ -16,7 +17,14 @@ public:
 		GObjectSerializer->SetPropertySerializer(PropertySerializer);
 	}
 
+	/* Data holds the mips one after the other, all of GetNumImportedMips are decoded in parallel */
 	bool CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
+
+	/* ReadData feeds the decoder, which writes into the texture's source as data arrives */
+	bool CreateTexture2D(UTexture*& OutTexture2D, TFunctionRef<bool(FTextureRowDecoder& Decoder)> ReadData, const TSharedPtr<FJsonObject>& Properties) const;
+
+	/* Data's mips become the texture's platform data as they are, the source is decoded later, see FTexturePreview */
+	bool CreatePreviewTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
 	bool CreateTextureCube(UTexture*& OutTextureCube, const TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
 	bool CreateVolumeTexture(UTexture*& OutVolumeTexture, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
 	bool CreateRenderTarget2D(UTexture*& OutRenderTarget2D, const TSharedPtr<FJsonObject>& Properties) const;
@@ -25,10 +33,28 @@ public:
 	bool DeserializeTexture2D(UTexture2D* InTexture2D, const TSharedPtr<FJsonObject>& Properties) const;
 	bool DeserializeTexture(UTexture* Texture, const TSharedPtr<FJsonObject>& Properties) const;
 
-private:
+	/* Mips of a Texture2D export to import, 1 unless importing all mips is enabled. Only as many as DataSize bytes hold. */
+	static int32 GetNumImportedMips(const TSharedPtr<FJsonObject>& Properties, int64 DataSize = MAX_int64);
+
+	/* Same, whatever the settings */
+	static int32 GetNumPayloadMips(const TSharedPtr<FJsonObject>& Properties, int64 DataSize = MAX_int64);
+
+	/* Decodes Payload into every mip of the texture's source, in parallel */
+	static void DecodeSourceMips(UTexture2D* Texture2D, EPixelFormat PixelFormat, const uint8* Payload);
+
+	/* Same, with each mip's payload on its own */
+	static void DecodeSourceMips(UTexture2D* Texture2D, EPixelFormat PixelFormat, TArrayView<const uint8* const> MipPayloads);
+
+	/* Source format a Texture2D's pixel format is decoded to */
+	static ETextureSourceFormat GetSourceFormat(UTexture2D* Texture2D);
+
 	static void GetDecompressedTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format);
 
 protected:
+	/* Texture with its properties and an uninitialized source of NumMips mips, or no source at all */
+	UTexture2D* NewTexture2D(const TSharedPtr<FJsonObject>& Properties, int32 NumMips, bool bInitSource = true) const;
+	bool FinishTexture2D(UTexture2D* Texture2D, bool bReadData, UTexture*& OutTexture2D) const;
+
 	FString FileName;
 	FString FilePath;
 	UPackage* Package;
@@ -0,0 +1,31 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * Downloads and decodes the Texture2Ds an import is about to create, ahead of it.
+ *
+ *   Download   Non-blocking requests to Local Fetch, completed whenever the HTTP module ticks
+ *   Decode     Task graph, into a buffer laid out like the texture's source mip
+ *   Finalize   Game thread, Construct_TypeTexture takes the decoded mip and creates the texture
+ *
+ * While one texture is created, the next ones decode and the ones after download. Downloads
+ * only start while the bytes the pipeline holds (encoded and decoded) fit in the budget from
+ * the texture import settings. A texture asked for before it started skips the budget, so an
+ * import never waits on the pipeline itself.
+ */
+class FTexturePipeline {
+public:
+	/* Queues textures whose exports were prefetched, in the order given. Paths are normalized like LoadObject's. */
+	static void Enqueue(const TArray<FString>& ObjectPaths);
+
+	/* Waits for a queued texture's decoded top mip. False if it wasn't queued or failed, it's not queued afterwards. */
+	static bool Take(const FString& ObjectPath, TArray64<uint8>& OutDecoded);
+
+	/* Drops everything still queued, at the end of the outermost import */
+	static void Reset();
+
+	static constexpr int32 MaxConcurrentDownloads = 4;
+};
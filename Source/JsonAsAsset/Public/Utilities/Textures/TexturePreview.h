@@ -0,0 +1,38 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Texture2D.h"
+
+/* How a preview texture's source is decoded from its platform data */
+struct FTexturePreviewSource {
+	EPixelFormat PixelFormat = PF_Unknown;
+	ETextureSourceFormat SourceFormat = TSF_BGRA8;
+	int32 NumSourceMips = 1;
+
+	/* Restored once decoded, the preview never streams */
+	bool bNeverStream = false;
+};
+
+/*
+ * Texture2Ds imported with fast preview, whose source hasn't been decoded yet.
+ *
+ * The export's block compressed mips are the texture's platform data as they are, so it renders
+ * without being decoded or compressed again. Editor packages don't store platform data though, so
+ * when the texture is about to be edited or saved, the platform data's mips are decoded into the
+ * source. The engine compresses it on the texture's next build, when it's reloaded or cooked.
+ *
+ * Tracked on the game thread, the delegates are only bound while there are previews.
+ */
+class FTexturePreview {
+public:
+	/* Fast preview is enabled, and the export's format is one the editor renders as it is */
+	static bool CanPassthrough(const TSharedPtr<FJsonObject>& Export);
+
+	static void Add(UTexture2D* Texture, FTexturePreviewSource&& Source);
+
+	/* Decodes the texture's source if it's still a preview. False if it wasn't one. */
+	static bool DecodeSource(UTexture2D* Texture);
+};
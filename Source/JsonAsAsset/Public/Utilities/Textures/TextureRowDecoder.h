@@ -0,0 +1,46 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+/*
+ * Decodes a mip one row of blocks at a time, as its data becomes available.
+ *
+ * Rows of 4x4 blocks are independent, so a download can be decoded while the rest of it
+ * is still arriving. The decoded rows go straight to the destination, usually the locked
+ * source mip of the texture, without an intermediate buffer.
+ */
+class FTextureRowDecoder {
+public:
+	FTextureRowDecoder(EPixelFormat InFormat, int32 InSizeX, int32 InSizeY, uint8* InDestination);
+
+	/* Bytes of encoded data for the whole mip */
+	int64 GetPayloadSize() const { return BlockRowBytes * NumBlockRows; }
+
+	/* Bytes the decoded mip takes */
+	static int64 GetDecodedSize(EPixelFormat Format, int32 SizeX, int32 SizeY);
+
+	/* Decodes the rows that are complete within the first Available bytes and not decoded yet */
+	void Decode(const uint8* Payload, int64 Available);
+
+	/* Takes the whole mip decoded elsewhere, false if it isn't this mip's decoded size */
+	bool SetDecoded(const uint8* Decoded, int64 Num);
+
+	bool IsComplete() const { return DecodedRows == NumBlockRows; }
+
+private:
+	static int32 GetDecodedBytesPerPixel(EPixelFormat Format);
+
+	EPixelFormat Format;
+	int32 SizeX;
+	int32 SizeY;
+	uint8* Destination;
+
+	int32 BlockSizeY;
+	int64 BlockRowBytes;
+	int32 NumBlockRows;
+
+	int32 DecodedRows = 0;
+};
@@ -17,6 +17,7 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
 #include "detex.h"
+#include "decompress-linear.h"
 
 /* Decompress a 64-bit 4x4 pixel texture block compressed using the BC1 */
 /* format. */
@@ -171,9 +172,11 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 }
 
 /* Decompress a 64-bit 4x4 pixel texture block compressed using the BC3 */
-/* format. */
-bool detexDecompressBlockBC3(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
-uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+/* format, row_pitch bytes between rows, as BGRA8 when swap_rb is set. */
+template <bool swap_rb>
+static DETEX_INLINE_ONLY bool DecompressBlockBC3(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
 	int alpha0 = bitstring[0];
 	int alpha1 = bitstring[1];
 	if (alpha0 > alpha1 && (flags & DETEX_DECOMPRESS_FLAG_OPAQUE_ONLY))
@@ -233,8 +236,25 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 			case 6 : alpha = 0; break;
 			case 7 : alpha = 0xFF; break;
 			}
-		*(uint32_t *)(pixel_buffer + i * 4) = detexPack32RGBA8(
-			color_r[pixel], color_g[pixel], color_b[pixel], alpha);
+		detexStoreBlockPixel32<swap_rb>(pixel_buffer, row_pitch, i, detexPack32RGBA8(
+			color_r[pixel], color_g[pixel], color_b[pixel], alpha));
 	}
 	return true;
 }
+
+bool detexDecompressBlockBC3(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
+uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+	return DecompressBlockBC3<false>(bitstring, mode_mask, flags, pixel_buffer, 16);
+}
+
+bool detexDecompressBlockLinearBC3_RGBA8(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	return DecompressBlockBC3<false>(bitstring, mode_mask, flags, pixel_buffer, row_pitch);
+}
+
+bool detexDecompressBlockLinearBC3_BGRA8(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	return DecompressBlockBC3<true>(bitstring, mode_mask, flags, pixel_buffer, row_pitch);
+}
@@ -19,6 +19,7 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include <detex.h>
 #include <bits.h>
 #include <bptc-tables.h>
+#include <decompress-linear.h>
 
 static const int8_t map_mode_table[32] = {
 	0, 1, 2, 10, -1, -1, 3, 11, -1, -1, 4, 12, -1, -1, 5, 13,
@@ -109,7 +110,7 @@ static int32_t InterpolateFloat(int32_t e0, int32_t e1, int16_t index, uint8_t i
 
 static bool DecompressBlockBPTCFloatShared(const uint8_t * DETEX_RESTRICT bitstring,
 uint32_t mode_mask, uint32_t flags, bool signed_flag,
-const uint8_t * DETEX_RESTRICT pixel_buffer) {
+uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t row_pitch) {
 	detexBlock128 block;
 	block.data0 = *(uint64_t *)&bitstring[0];
 	block.data1 = *(uint64_t *)&bitstring[8];
@@ -620,7 +621,7 @@ const uint8_t * DETEX_RESTRICT pixel_buffer) {
 			output |= detexPack64B16(InterpolateFloat(endpoint_start_b, endpoint_end_b, color_index[i],
 				color_index_bit_count) * 31 / 64);
 		}
-		*(uint64_t *)&pixel_buffer[i * 8] = output;
+		detexStoreBlockPixel64(pixel_buffer, row_pitch, i, output);
 	}
 	return true;
 }
@@ -631,7 +632,14 @@ const uint8_t * DETEX_RESTRICT pixel_buffer) {
 bool detexDecompressBlockBPTC_FLOAT(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
 uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 	return DecompressBlockBPTCFloatShared(bitstring, mode_mask, flags, false,
-		pixel_buffer);
+		pixel_buffer, 32);
+}
+
+bool detexDecompressBlockLinearBPTC_FLOAT(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	return DecompressBlockBPTCFloatShared(bitstring, mode_mask, flags, false,
+		pixel_buffer, row_pitch);
 }
 
 /* Decompress a 128-bit 4x4 pixel texture block compressed using the */
@@ -640,7 +648,7 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 bool detexDecompressBlockBPTC_SIGNED_FLOAT(const uint8_t * DETEX_RESTRICT bitstring,
 uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 	return DecompressBlockBPTCFloatShared(bitstring, mode_mask, flags, true,
-		pixel_buffer);
+		pixel_buffer, 32);
 }
 
 /* Return the internal mode of the BPTC_FLOAT block. */
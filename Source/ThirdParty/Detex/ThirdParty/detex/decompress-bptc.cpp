@@ -19,6 +19,7 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include <detex.h>
 #include <bits.h>
 #include <bptc-tables.h>
+#include <decompress-linear.h>
 
 // BPTC mode layout:
 //
@@ -268,8 +269,9 @@ static const uint8_t mode_has_partition_bits[8] = { 1, 1, 1, 1, 0, 0, 0, 1 };
 
 /* Decompress a 128-bit 4x4 pixel texture block compressed using BPTC mode 1. */
 
+template <bool swap_rb>
 static bool DecompressBlockBPTCMode1(detexBlock128 * DETEX_RESTRICT block,
-uint8_t * DETEX_RESTRICT pixel_buffer) {
+uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t row_pitch) {
 	uint64_t data0 = block->data0;
 	uint64_t data1 = block->data1;
 	int partition_set_id = detexGetBits64(data0, 2, 7);
@@ -331,7 +333,6 @@ uint8_t * DETEX_RESTRICT pixel_buffer) {
 			color_index[i] = data1 & 7;	// Get three bits.
 			data1 >>= 3;
 		}
-	uint32_t *pixel32_buffer = (uint32_t *)pixel_buffer;
 	for (int i = 0; i < 16; i++) {
 		uint8_t endpoint_start[3];
 		uint8_t endpoint_end[3];
@@ -344,15 +345,17 @@ uint8_t * DETEX_RESTRICT pixel_buffer) {
 		output |= detexPack32G8(Interpolate(endpoint_start[1], endpoint_end[1], color_index[i], 3));
 		output |= detexPack32B8(Interpolate(endpoint_start[2], endpoint_end[2], color_index[i], 3));
 		output |= detexPack32A8(0xFF);
-		pixel32_buffer[i] = output;
+		detexStoreBlockPixel32<swap_rb>(pixel_buffer, row_pitch, i, output);
 	}
 	return true;
 }
 
 /* Decompress a 128-bit 4x4 pixel texture block compressed using the BPTC */
-/* (BC7) format. */
-bool detexDecompressBlockBPTC(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
-uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+/* (BC7) format, row_pitch bytes between rows, as BGRA8 when swap_rb is set. */
+template <bool swap_rb>
+static DETEX_INLINE_ONLY bool DecompressBlockBPTC(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
 	detexBlock128 block;
 	block.data0 = *(uint64_t *)&bitstring[0];
 	block.data1 = *(uint64_t *)&bitstring[8];
@@ -368,7 +371,7 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 	if (mode < 4 && (flags & DETEX_DECOMPRESS_FLAG_NON_OPAQUE_ONLY))
 		return 0;
 	if (mode == 1)
-		return DecompressBlockBPTCMode1(&block, pixel_buffer);
+		return DecompressBlockBPTCMode1<swap_rb>(&block, pixel_buffer, row_pitch);
 
 	int nu_subsets = 1;
 	int partition_set_id = 0;
@@ -479,7 +482,6 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 			}
 	}
 
-	uint32_t *pixel32_buffer = (uint32_t *)pixel_buffer;
 	for (int i = 0; i < 16; i++) {
 		uint8_t endpoint_start[4];
 		uint8_t endpoint_end[4];
@@ -506,11 +508,28 @@ uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
 				output = detexPack32RGBA8(detexPixel32GetR8(output), detexPixel32GetG8(output),
 					detexPixel32GetA8(output), detexPixel32GetB8(output));
 		}
-		pixel32_buffer[i] = output;
+		detexStoreBlockPixel32<swap_rb>(pixel_buffer, row_pitch, i, output);
 	}
 	return true;
 }
 
+bool detexDecompressBlockBPTC(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
+uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+	return DecompressBlockBPTC<false>(bitstring, mode_mask, flags, pixel_buffer, 16);
+}
+
+bool detexDecompressBlockLinearBPTC_RGBA8(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	return DecompressBlockBPTC<false>(bitstring, mode_mask, flags, pixel_buffer, row_pitch);
+}
+
+bool detexDecompressBlockLinearBPTC_BGRA8(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	return DecompressBlockBPTC<true>(bitstring, mode_mask, flags, pixel_buffer, row_pitch);
+}
+
 #if 0
 /* Modify compressed block to use specific colors. For later use. */
 static void SetBlockColors(uint8_t * DETEX_RESTRICT bitstring, uint32_t flags,
@@ -0,0 +1,70 @@
+/*
+
+Copyright (c) 2015 Harm Hanemaaijer <fgenfb@yahoo.com>
+
+Permission to use, copy, modify, and/or distribute this software for any
+purpose with or without fee is hereby granted, provided that the above
+copyright notice and this permission notice appear in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "detex.h"
+
+/*
+ * Block decoders that write straight into a linear image, used by
+ * detexDecompressTextureLinear for the (texture format, pixel format) pairs
+ * that have one. Pixels are stored in their final layout, row_pitch bytes
+ * apart, so there is no conversion or copy of a temporary block afterwards.
+ */
+
+typedef bool (*detexDecompressBlockLinearFuncType)(const uint8_t *bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t *pixel_buffer, uint32_t row_pitch);
+
+/* Store pixel i (0 to 15) of a block of 32-bit RGBA8 pixels, as BGRA8 when */
+/* swap_rb is set. */
+template <bool swap_rb>
+static DETEX_INLINE_ONLY void detexStoreBlockPixel32(uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch, int i, uint32_t pixel) {
+	if (swap_rb)
+		pixel = detexPack32RGBA8(detexPixel32GetB8(pixel), detexPixel32GetG8(pixel),
+			detexPixel32GetR8(pixel), detexPixel32GetA8(pixel));
+	*(uint32_t *)(pixel_buffer + (i >> 2) * row_pitch + (i & 3) * 4) = pixel;
+}
+
+/* Store pixel i (0 to 15) of a block of 64-bit pixels. */
+static DETEX_INLINE_ONLY void detexStoreBlockPixel64(uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch, int i, uint64_t pixel) {
+	*(uint64_t *)(pixel_buffer + (i >> 2) * row_pitch + (i & 3) * 8) = pixel;
+}
+
+bool detexDecompressBlockLinearBC3_RGBA8(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearBC3_BGRA8(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearBPTC_RGBA8(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearBPTC_BGRA8(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearBPTC_FLOAT(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearRGTC1(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
+bool detexDecompressBlockLinearRGTC2(const uint8_t * DETEX_RESTRICT bitstring,
+	uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+	uint32_t row_pitch);
@@ -0,0 +1,89 @@
+/*
+
+Copyright (c) 2015 Harm Hanemaaijer <fgenfb@yahoo.com>
+
+Permission to use, copy, modify, and/or distribute this software for any
+purpose with or without fee is hereby granted, provided that the above
+copyright notice and this permission notice appear in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "detex.h"
+#include "decompress-linear.h"
+
+// Decodes one 64-bit RGTC (BC4) channel to every stride'th byte of pixel_buffer, starting at
+// offset, with row_pitch bytes between rows. The channel uses the same encoding as the BC3
+// alpha channel.
+static DETEX_INLINE_ONLY void DecodeBlockRGTC(const uint8_t * DETEX_RESTRICT bitstring, int offset,
+int stride, uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t row_pitch) {
+	int red0 = bitstring[0];
+	int red1 = bitstring[1];
+	uint64_t bits = (uint32_t)bitstring[2] |
+		((uint32_t)bitstring[3] << 8) |
+		((uint64_t)bitstring[4] << 16) |
+		((uint64_t)bitstring[5] << 24) |
+		((uint64_t)bitstring[6] << 32) |
+		((uint64_t)bitstring[7] << 40);
+	uint8_t palette[8];
+	palette[0] = red0;
+	palette[1] = red1;
+	if (red0 > red1) {
+		palette[2] = detexDivide0To1791By7(6 * red0 + 1 * red1);
+		palette[3] = detexDivide0To1791By7(5 * red0 + 2 * red1);
+		palette[4] = detexDivide0To1791By7(4 * red0 + 3 * red1);
+		palette[5] = detexDivide0To1791By7(3 * red0 + 4 * red1);
+		palette[6] = detexDivide0To1791By7(2 * red0 + 5 * red1);
+		palette[7] = detexDivide0To1791By7(1 * red0 + 6 * red1);
+	}
+	else {
+		palette[2] = detexDivide0To1279By5(4 * red0 + 1 * red1);
+		palette[3] = detexDivide0To1279By5(3 * red0 + 2 * red1);
+		palette[4] = detexDivide0To1279By5(2 * red0 + 3 * red1);
+		palette[5] = detexDivide0To1279By5(1 * red0 + 4 * red1);
+		palette[6] = 0;
+		palette[7] = 0xFF;
+	}
+	for (int i = 0; i < 16; i++)
+		pixel_buffer[(i >> 2) * row_pitch + (i & 3) * stride + offset] =
+			palette[(bits >> (i * 3)) & 0x7];
+}
+
+/* Decompress a 64-bit 4x4 pixel texture block compressed using the */
+/* unsigned RGTC1 (BC4) format. */
+bool detexDecompressBlockRGTC1(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
+uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+	DecodeBlockRGTC(bitstring, 0, 1, pixel_buffer, 4);
+	return true;
+}
+
+/* Decompress a 128-bit 4x4 pixel texture block compressed using the */
+/* unsigned RGTC2 (BC5) format. */
+bool detexDecompressBlockRGTC2(const uint8_t * DETEX_RESTRICT bitstring, uint32_t mode_mask,
+uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer) {
+	DecodeBlockRGTC(bitstring, 0, 2, pixel_buffer, 8);
+	DecodeBlockRGTC(&bitstring[8], 1, 2, pixel_buffer, 8);
+	return true;
+}
+
+bool detexDecompressBlockLinearRGTC1(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	DecodeBlockRGTC(bitstring, 0, 1, pixel_buffer, row_pitch);
+	return true;
+}
+
+bool detexDecompressBlockLinearRGTC2(const uint8_t * DETEX_RESTRICT bitstring,
+uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
+uint32_t row_pitch) {
+	DecodeBlockRGTC(bitstring, 0, 2, pixel_buffer, row_pitch);
+	DecodeBlockRGTC(&bitstring[8], 1, 2, pixel_buffer, row_pitch);
+	return true;
+}
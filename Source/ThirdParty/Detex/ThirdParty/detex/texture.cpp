@@ -20,31 +20,32 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 #include "detex.h"
 #include "misc.h"
+#include "decompress-linear.h"
 
 typedef bool (*detexDecompressBlockFuncType)(const uint8_t *bitstring,
 	uint32_t mode_mask, uint32_t flags, uint8_t *pixel_buffer);
 
 static detexDecompressBlockFuncType decompress_function[] = {
 	NULL,
-	NULL, // detexDecompressBlockBC1,
-	NULL, // detexDecompressBlockBC1A,
-	NULL, // detexDecompressBlockBC2,
+	detexDecompressBlockBC1,
+	detexDecompressBlockBC1A,
+	detexDecompressBlockBC2,
 	detexDecompressBlockBC3,
-	NULL, // detexDecompressBlockRGTC1,
-	NULL, // detexDecompressBlockSIGNED_RGTC1,
-	NULL, // detexDecompressBlockRGTC2,
-	NULL, // detexDecompressBlockSIGNED_RGTC2,
+	detexDecompressBlockRGTC1,
+	NULL, // detexDecompressBlockSIGNED_RGTC1, not vendored
+	detexDecompressBlockRGTC2,
+	NULL, // detexDecompressBlockSIGNED_RGTC2, not vendored
 	detexDecompressBlockBPTC_FLOAT,
-	NULL, // detexDecompressBlockBPTC_SIGNED_FLOAT,
+	detexDecompressBlockBPTC_SIGNED_FLOAT,
 	detexDecompressBlockBPTC,
 	detexDecompressBlockETC1,
 	detexDecompressBlockETC2,
 	detexDecompressBlockETC2_PUNCHTHROUGH,
 	detexDecompressBlockETC2_EAC,
-	NULL, // detexDecompressBlockEAC_R11,
-	NULL, // detexDecompressBlockEAC_SIGNED_R11,
-	NULL, // detexDecompressBlockEAC_RG11,
-	NULL, // detexDecompressBlockEAC_SIGNED_RG11,
+	detexDecompressBlockEAC_R11,
+	detexDecompressBlockEAC_SIGNED_R11,
+	detexDecompressBlockEAC_RG11,
+	detexDecompressBlockEAC_SIGNED_RG11,
 };
 
 /*
@@ -57,6 +58,11 @@ uint32_t mode_mask, uint32_t flags, uint8_t * DETEX_RESTRICT pixel_buffer,
 uint32_t pixel_format) {
 	uint8_t block_buffer[DETEX_MAX_BLOCK_SIZE];
 	uint32_t compressed_format = detexGetCompressedFormat(texture_format);
+	if (decompress_function[compressed_format] == NULL) {
+		detexSetErrorMessage("detexDecompressBlock: No decompress function for format "
+			"0x%08X", texture_format);
+		return false;
+	}
 	bool r = decompress_function[compressed_format](bitstring, mode_mask, flags,
             block_buffer);
 	if (!r) {
@@ -97,6 +103,82 @@ uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t pixel_format) {
 	return result;
 }
 
+/* Block decoders that store straight into a linear image, see decompress-linear.h. */
+static const struct {
+	uint32_t texture_format;
+	uint32_t pixel_format;
+	detexDecompressBlockLinearFuncType function;
+} decompress_linear_function[] = {
+	{ DETEX_TEXTURE_FORMAT_BC3, DETEX_PIXEL_FORMAT_RGBA8, detexDecompressBlockLinearBC3_RGBA8 },
+	{ DETEX_TEXTURE_FORMAT_BC3, DETEX_PIXEL_FORMAT_BGRA8, detexDecompressBlockLinearBC3_BGRA8 },
+	{ DETEX_TEXTURE_FORMAT_RGTC1, DETEX_PIXEL_FORMAT_R8, detexDecompressBlockLinearRGTC1 },
+	{ DETEX_TEXTURE_FORMAT_RGTC2, DETEX_PIXEL_FORMAT_RG8, detexDecompressBlockLinearRGTC2 },
+	{ DETEX_TEXTURE_FORMAT_BPTC_FLOAT, DETEX_PIXEL_FORMAT_FLOAT_RGBX16,
+		detexDecompressBlockLinearBPTC_FLOAT },
+	{ DETEX_TEXTURE_FORMAT_BPTC, DETEX_PIXEL_FORMAT_RGBA8, detexDecompressBlockLinearBPTC_RGBA8 },
+	{ DETEX_TEXTURE_FORMAT_BPTC, DETEX_PIXEL_FORMAT_BGRA8, detexDecompressBlockLinearBPTC_BGRA8 },
+};
+
+static detexDecompressBlockLinearFuncType GetDecompressLinearFunction(uint32_t texture_format,
+uint32_t pixel_format) {
+	for (size_t i = 0; i < sizeof(decompress_linear_function) /
+	sizeof(decompress_linear_function[0]); i++)
+		if (decompress_linear_function[i].texture_format == texture_format &&
+		decompress_linear_function[i].pixel_format == pixel_format)
+			return decompress_linear_function[i].function;
+	return NULL;
+}
+
+/*
+ * Decode an entire texture with a linear block decoder. Whole blocks are
+ * stored straight into the image, blocks cut by the right or bottom edge are
+ * decoded into a temporary and cropped.
+ */
+static bool DecompressTextureLinearDirect(const detexTexture *texture,
+uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t pixel_format,
+detexDecompressBlockLinearFuncType function) {
+	uint8_t block_buffer[DETEX_MAX_BLOCK_SIZE];
+	const uint8_t *data = texture->data;
+	uint32_t pixel_size = detexGetPixelSize(pixel_format);
+	uint32_t row_pitch = texture->width * pixel_size;
+	uint32_t compressed_block_size = detexGetCompressedBlockSize(texture->format);
+	bool result = true;
+	for (int y = 0; y < texture->height_in_blocks; y++) {
+		int nu_rows;
+		if (y * 4 + 3 >= texture->height)
+			nu_rows = texture->height - y * 4;
+		else
+			nu_rows = 4;
+		for (int x = 0; x < texture->width_in_blocks; x++) {
+			int nu_columns;
+			if (x * 4 + 3 >= texture->width)
+				nu_columns = texture->width - x * 4;
+			else
+				nu_columns = 4;
+			uint8_t *pixelp = pixel_buffer + (size_t)y * 4 * row_pitch +
+				(size_t)x * 4 * pixel_size;
+			if (nu_rows == 4 && nu_columns == 4) {
+				if (!function(data, DETEX_MODE_MASK_ALL, 0, pixelp, row_pitch)) {
+					result = false;
+					for (int row = 0; row < 4; row++)
+						memset(pixelp + row * row_pitch, 0, 4 * pixel_size);
+				}
+			}
+			else {
+				if (!function(data, DETEX_MODE_MASK_ALL, 0, block_buffer, 4 * pixel_size)) {
+					result = false;
+					memset(block_buffer, 0, 16 * pixel_size);
+				}
+				for (int row = 0; row < nu_rows; row++)
+					memcpy(pixelp + row * row_pitch, block_buffer + row * 4 * pixel_size,
+						nu_columns * pixel_size);
+			}
+			data += compressed_block_size;
+		}
+	}
+	return result;
+}
+
 /*
  * Decode texture function (linear). Decode an entire texture into a single
  * image buffer, with pixels stored row-by-row, converting into the given pixel
@@ -109,6 +191,12 @@ uint8_t * DETEX_RESTRICT pixel_buffer, uint32_t pixel_format) {
 		return detexConvertPixels(texture->data, texture->width * texture->height,
 			detexGetPixelFormat(texture->format), pixel_buffer, pixel_format);
 	}
+	// No conversion nor copy for the pairs that have a linear block decoder.
+	detexDecompressBlockLinearFuncType linear_function =
+		GetDecompressLinearFunction(texture->format, pixel_format);
+	if (linear_function != NULL)
+		return DecompressTextureLinearDirect(texture, pixel_buffer, pixel_format,
+			linear_function);
 	const uint8_t *data = texture->data;
 	int pixel_size = detexGetPixelSize(pixel_format);
 	bool result = true;